@@ -617,9 +617,18 @@ void acb_gamma(acb_t y, const acb_t x, long prec);
 void acb_rgamma(acb_t y, const acb_t x, long prec);
 void acb_lgamma(acb_t y, const acb_t x, long prec);
 void acb_digamma(acb_t y, const acb_t x, long prec);
+
+void _acb_vec_gamma(acb_ptr res, acb_srcptr x, long len, long prec);
+void _acb_vec_lgamma(acb_ptr res, acb_srcptr x, long len, long prec);
 void acb_zeta(acb_t z, const acb_t s, long prec);
 void acb_hurwitz_zeta(acb_t z, const acb_t s, const acb_t a, long prec);
 
+#define ACB_ZETA_RS_MAX_K 4
+
+long acb_zeta_rs_choose_k(const acb_t s, long prec);
+int acb_zeta_rs(acb_t z, const acb_t s, long K, long prec);
+int _acb_zeta_rs_correction(arb_t r, long * N, const arb_t t, long K, long prec);
+
 void acb_polylog(acb_t w, const acb_t s, const acb_t z, long prec);
 void acb_polylog_si(acb_t w, long s, const acb_t z, long prec);
 
@@ -32,10 +32,11 @@ acb_gamma_stirling_choose_param(int * reflect, long * r, long * n,
 
 void acb_gamma_stirling_bound(mag_ptr err, const acb_t z, long k0, long knum, long n);
 
-void arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, long prec);
-
+/* c, if not NULL, holds the coefficients as returned by
+   arb_gamma_stirling_coeffs_cached (with at least nterms entries) */
 void
-acb_gamma_stirling_eval(acb_t s, const acb_t z, long nterms, int digamma, long prec)
+_acb_gamma_stirling_eval(acb_t s, const acb_t z, long nterms, int digamma,
+    arb_srcptr c, long prec)
 {
     acb_t t, logz, zinv, zinv2;
     arb_t b;
@@ -58,31 +59,76 @@ acb_gamma_stirling_eval(acb_t s, const acb_t z, long nterms, int digamma, long p
     acb_zero(s);
     if (nterms > 1)
     {
+        acb_ptr ws;
+        long j, m, len, top, block_prec;
+
         acb_mul(zinv2, zinv, zinv, prec);
 
         z_mag = arf_get_d(arb_midref(acb_realref(logz)), ARF_RND_UP) * 1.44269504088896;
 
-        for (k = nterms - 1; k >= 1; k--)
+        if (c == NULL && prec <= ARB_GAMMA_STIRLING_CACHE_MAX_PREC)
+            c = arb_gamma_stirling_coeffs_cached(nterms, digamma, prec);
+
+        /*
+        Rectangular splitting: s = sum_{k=1}^{len} c_k w^(k-1), w = 1/z^2,
+        is evaluated as a polynomial in w^m whose coefficients are
+        combinations of the precomputed powers 1, w, ..., w^(m-1). The
+        inner products are real times complex, which is about half as
+        expensive as the complex multiplications of Horner's rule.
+        */
+        len = nterms - 1;
+        m = n_sqrt(len);
+        m = FLINT_MAX(m, 1);
+
+        ws = _acb_vec_init(m + 1);
+        _acb_vec_set_powers(ws, zinv2, m + 1, prec);
+
+        top = ((len - 1) / m) * m;
+
+        for (j = top; j >= 0; j -= m)
         {
+            /* the term precision decreases with k, so the first
+               term of each block needs the highest precision */
+            k = j + 1;
             term_mag = bernoulli_bound_2exp_si(2 * k);
             term_mag -= (2 * k - 1) * z_mag;
-            term_prec = prec + term_mag;
-            term_prec = FLINT_MIN(term_prec, prec);
-            term_prec = FLINT_MAX(term_prec, 10);
+            block_prec = prec + term_mag;
+            block_prec = FLINT_MIN(block_prec, prec);
+            block_prec = FLINT_MAX(block_prec, 10);
 
-            arb_gamma_stirling_coeff(b, k, digamma, term_prec);
-
-            if (prec > 2000)
+            if (j != top)
             {
-                acb_set_round(t, zinv2, term_prec);
-                acb_mul(s, s, t, term_prec);
+                if (prec > 2000)
+                {
+                    acb_set_round(t, ws + m, block_prec);
+                    acb_mul(s, s, t, block_prec);
+                }
+                else
+                    acb_mul(s, s, ws + m, block_prec);
             }
-            else
-                acb_mul(s, s, zinv2, term_prec);
 
-            arb_add(acb_realref(s), acb_realref(s), b, term_prec);
+            for (k = FLINT_MIN(j + m, len); k >= j + 1; k--)
+            {
+                term_mag = bernoulli_bound_2exp_si(2 * k);
+                term_mag -= (2 * k - 1) * z_mag;
+                term_prec = prec + term_mag;
+                term_prec = FLINT_MIN(term_prec, prec);
+                term_prec = FLINT_MAX(term_prec, 10);
+
+                if (c != NULL)
+                    arb_set_round(b, c + k, term_prec);
+                else
+                    _arb_gamma_stirling_coeff(b, k, digamma, term_prec);
+
+                if (k == j + 1)
+                    arb_add(acb_realref(s), acb_realref(s), b, block_prec);
+                else
+                    acb_addmul_arb(s, ws + (k - j - 1), b, block_prec);
+            }
         }
 
+        _acb_vec_clear(ws, m + 1);
+
         if (digamma)
             acb_mul(s, s, zinv2, prec);
         else
@@ -124,17 +170,23 @@ acb_gamma_stirling_eval(acb_t s, const acb_t z, long nterms, int digamma, long p
     arb_clear(b);
 }
 
-static void
-_acb_gamma(acb_t y, const acb_t x, long prec, int inverse)
+void
+acb_gamma_stirling_eval(acb_t s, const acb_t z, long nterms, int digamma, long prec)
 {
-    int reflect;
-    long r, n, wp;
+    _acb_gamma_stirling_eval(s, z, nterms, digamma, NULL, prec);
+}
+
+/* evaluates gamma (or its reciprocal) given the parameters chosen by
+   acb_gamma_stirling_choose_param at precision prec + bits(prec) */
+void
+_acb_gamma_stirling(acb_t y, const acb_t x, int reflect, long r, long n,
+    arb_srcptr c, long prec, int inverse)
+{
+    long wp;
     acb_t t, u, v;
 
     wp = prec + FLINT_BIT_COUNT(prec);
 
-    acb_gamma_stirling_choose_param(&reflect, &r, &n, x, 1, 0, wp);
-
     acb_init(t);
     acb_init(u);
     acb_init(v);
@@ -148,7 +200,7 @@ _acb_gamma(acb_t y, const acb_t x, long prec, int inverse)
         arb_const_pi(acb_realref(v), wp);
         acb_mul_arb(u, u, acb_realref(v), wp);
         acb_add_ui(t, t, r, wp);
-        acb_gamma_stirling_eval(v, t, n, 0, wp);
+        _acb_gamma_stirling_eval(v, t, n, 0, c, wp);
         acb_exp(v, v, wp);
         acb_sin_pi(t, x, wp);
         acb_mul(v, v, t, wp);
@@ -157,7 +209,7 @@ _acb_gamma(acb_t y, const acb_t x, long prec, int inverse)
     {
         /* gamma(x) = gamma(x+r) / rf(x,r) */
         acb_add_ui(t, x, r, wp);
-        acb_gamma_stirling_eval(u, t, n, 0, wp);
+        _acb_gamma_stirling_eval(u, t, n, 0, c, wp);
         acb_exp(u, u, prec);
         acb_rising_ui_rec(v, x, r, wp);
     }
@@ -172,6 +224,19 @@ _acb_gamma(acb_t y, const acb_t x, long prec, int inverse)
     acb_clear(v);
 }
 
+static void
+_acb_gamma(acb_t y, const acb_t x, long prec, int inverse)
+{
+    int reflect;
+    long r, n, wp;
+
+    wp = prec + FLINT_BIT_COUNT(prec);
+
+    acb_gamma_stirling_choose_param(&reflect, &r, &n, x, 1, 0, wp);
+
+    _acb_gamma_stirling(y, x, reflect, r, n, NULL, prec, inverse);
+}
+
 void
 acb_gamma(acb_t y, const acb_t x, long prec)
 {
@@ -251,23 +316,23 @@ _acb_log_rising_correct_branch(acb_t t,
     fmpz_clear(pi_mult);
 }
 
+/* evaluates log gamma given the parameters chosen by
+   acb_gamma_stirling_choose_param at precision prec + bits(prec) */
 void
-acb_lgamma(acb_t y, const acb_t x, long prec)
+_acb_lgamma_stirling(acb_t y, const acb_t x, long r, long n,
+    arb_srcptr c, long prec)
 {
-    int reflect;
-    long r, n, wp;
+    long wp;
     acb_t t, u;
 
     wp = prec + FLINT_BIT_COUNT(prec);
 
-    acb_gamma_stirling_choose_param(&reflect, &r, &n, x, 0, 0, wp);
-
     /* log(gamma(x)) = log(gamma(x+r)) - log(rf(x,r)) */
     acb_init(t);
     acb_init(u);
 
     acb_add_ui(t, x, r, wp);
-    acb_gamma_stirling_eval(u, t, n, 0, wp);
+    _acb_gamma_stirling_eval(u, t, n, 0, c, wp);
 
     acb_rising_ui_rec(t, x, r, prec);
     acb_log(t, t, prec);
@@ -280,3 +345,16 @@ acb_lgamma(acb_t y, const acb_t x, long prec)
     acb_clear(u);
 }
 
+void
+acb_lgamma(acb_t y, const acb_t x, long prec)
+{
+    int reflect;
+    long r, n, wp;
+
+    wp = prec + FLINT_BIT_COUNT(prec);
+
+    acb_gamma_stirling_choose_param(&reflect, &r, &n, x, 0, 0, wp);
+
+    _acb_lgamma_stirling(y, x, r, n, NULL, prec);
+}
+
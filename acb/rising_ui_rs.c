@@ -25,8 +25,6 @@
 
 #include "acb.h"
 
-void rising_difference_polynomial(fmpz * s, fmpz * c, ulong m);
-
 void
 acb_rising_ui_rs(acb_t y, const acb_t x, ulong n, ulong m, long prec)
 {
@@ -34,7 +32,9 @@ acb_rising_ui_rs(acb_t y, const acb_t x, ulong n, ulong m, long prec)
     acb_t t, u, v;
     ulong i, k, rem;
     fmpz_t c, h;
-    fmpz *s, *d;
+    const fmpz *s, *d;
+    const arb_rising_plan_struct * plan;
+    arb_rising_plan_t tmp;
     long wp;
 
     if (n == 0)
@@ -69,12 +69,21 @@ acb_rising_ui_rs(acb_t y, const acb_t x, ulong n, ulong m, long prec)
     m = FLINT_MAX(m, 1);
 
     xs = _acb_vec_init(m + 1);
-    d = _fmpz_vec_init(m * m);
-    s = _fmpz_vec_init(m + 1);
 
     _acb_vec_set_powers(xs, x, m + 1, wp);
 
-    rising_difference_polynomial(s, d, m);
+    if (m <= ARB_RISING_PLAN_CACHE_MAX_M)
+    {
+        plan = arb_rising_plan_cached(m);
+    }
+    else
+    {
+        arb_rising_plan_init(tmp, m);
+        plan = tmp;
+    }
+
+    s = plan->s;
+    d = plan->d;
 
     /* tail */
     rem = m;
@@ -120,8 +129,9 @@ acb_rising_ui_rs(acb_t y, const acb_t x, ulong n, ulong m, long prec)
     acb_clear(u);
     acb_clear(v);
     _acb_vec_clear(xs, m + 1);
-    _fmpz_vec_clear(d, m * m);
-    _fmpz_vec_clear(s, m + 1);
+
+    if (plan == tmp)
+        arb_rising_plan_clear(tmp);
     fmpz_clear(c);
     fmpz_clear(h);
 }
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb.h"
+
+int main(void)
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("vec_gamma....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500; iter++)
+    {
+        acb_ptr x, y, z;
+        long i, len, prec;
+        int lgamma, alias;
+
+        len = n_randint(state, 20);
+        prec = 2 + n_randint(state, 500);
+        lgamma = n_randint(state, 2);
+        alias = n_randint(state, 2);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(len);
+        z = _acb_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_randtest(x + i, state, 1 + n_randint(state, 500),
+                1 + n_randint(state, 10));
+
+            if (lgamma)
+                acb_lgamma(z + i, x + i, prec);
+            else
+                acb_gamma(z + i, x + i, prec);
+        }
+
+        if (alias)
+        {
+            _acb_vec_set(y, x, len);
+
+            if (lgamma)
+                _acb_vec_lgamma(y, y, len, prec);
+            else
+                _acb_vec_gamma(y, y, len, prec);
+        }
+        else
+        {
+            if (lgamma)
+                _acb_vec_lgamma(y, x, len, prec);
+            else
+                _acb_vec_gamma(y, x, len, prec);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_overlaps(y + i, z + i))
+            {
+                printf("FAIL: overlap\n\n");
+                printf("lgamma = %d, i = %ld\n\n", lgamma, i);
+                printf("x = "); acb_printd(x + i, 30); printf("\n\n");
+                printf("y = "); acb_printd(y + i, 30); printf("\n\n");
+                printf("z = "); acb_printd(z + i, 30); printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, len);
+        _acb_vec_clear(z, len);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,172 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "acb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("zeta_rs....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_t s, a, z1, z2;
+        long K, prec;
+
+        acb_init(s);
+        acb_init(a);
+        acb_init(z1);
+        acb_init(z2);
+
+        prec = 2 + n_randint(state, 100);
+        K = n_randint(state, ACB_ZETA_RS_MAX_K + 1);
+
+        arb_one(acb_realref(s));
+        arb_mul_2exp_si(acb_realref(s), acb_realref(s), -1);
+        arb_set_ui(acb_imagref(s), 200 + n_randint(state, 20000));
+        arb_div_ui(acb_imagref(s), acb_imagref(s), 1 + n_randint(state, 10),
+            prec);
+        arb_add_ui(acb_imagref(s), acb_imagref(s), 200, prec);
+        if (n_randint(state, 2))
+            arb_neg(acb_imagref(s), acb_imagref(s));
+
+        if (acb_zeta_rs(z1, s, K, prec))
+        {
+            acb_one(a);
+            acb_hurwitz_zeta(z2, s, a, prec);
+        }
+        else
+        {
+            acb_zero(z1);
+            acb_zero(z2);
+        }
+
+        if (!acb_overlaps(z1, z2))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("iter = %ld, K = %ld, prec = %ld\n\n", iter, K, prec);
+            printf("s = "); acb_printd(s, 30); printf("\n\n");
+            printf("z1 = "); acb_printd(z1, 30); printf("\n\n");
+            printf("z2 = "); acb_printd(z2, 30); printf("\n\n");
+            abort();
+        }
+
+        acb_clear(s);
+        acb_clear(a);
+        acb_clear(z1);
+        acb_clear(z2);
+    }
+
+    /* acb_zeta switches to the Riemann-Siegel formula automatically */
+    for (iter = 0; iter < 500; iter++)
+    {
+        acb_t s, a, z1, z2;
+        long K, N, prec;
+        int straddle;
+
+        acb_init(s);
+        acb_init(a);
+        acb_init(z1);
+        acb_init(z2);
+
+        prec = 2 + n_randint(state, 20);
+        straddle = (n_randint(state, 4) == 0);
+
+        arb_one(acb_realref(s));
+        arb_mul_2exp_si(acb_realref(s), acb_realref(s), -1);
+
+        if (straddle)
+        {
+            /* a ball containing 2 pi N^2, so that floor(sqrt(t/(2pi)))
+               is not determined by t */
+            N = 18 + n_randint(state, 40);
+            arb_const_pi(acb_imagref(s), prec + 30);
+            arb_mul_ui(acb_imagref(s), acb_imagref(s), 2 * N * N, prec + 30);
+            mag_set_ui_2exp_si(arb_radref(acb_imagref(s)), 1, -20);
+        }
+        else
+        {
+            arb_set_ui(acb_imagref(s), 2100 + n_randint(state, 20000));
+            arb_mul_2exp_si(acb_imagref(s), acb_imagref(s),
+                -(long) n_randint(state, 4));
+            arb_add_ui(acb_imagref(s), acb_imagref(s), 2100, prec + 30);
+        }
+
+        if (n_randint(state, 2))
+            arb_neg(acb_imagref(s), acb_imagref(s));
+
+        K = acb_zeta_rs_choose_k(s, prec);
+
+        if (K < 0)
+        {
+            printf("FAIL: choose_k\n\n");
+            printf("iter = %ld, prec = %ld\n\n", iter, prec);
+            printf("s = "); acb_printd(s, 30); printf("\n\n");
+            abort();
+        }
+
+        acb_zeta(z1, s, prec);
+        acb_one(a);
+        acb_hurwitz_zeta(z2, s, a, prec + 20);
+
+        if (!acb_overlaps(z1, z2))
+        {
+            printf("FAIL: overlap (acb_zeta)\n\n");
+            printf("iter = %ld, K = %ld, prec = %ld\n\n", iter, K, prec);
+            printf("s = "); acb_printd(s, 30); printf("\n\n");
+            printf("z1 = "); acb_printd(z1, 30); printf("\n\n");
+            printf("z2 = "); acb_printd(z2, 30); printf("\n\n");
+            abort();
+        }
+
+        /* the remainder bound is below 2^-prec, and |zeta| = |Z| */
+        if (!straddle &&
+            (mag_cmp_2exp_si(arb_radref(acb_realref(z1)), -prec + 10) > 0 ||
+             mag_cmp_2exp_si(arb_radref(acb_imagref(z1)), -prec + 10) > 0))
+        {
+            printf("FAIL: accuracy (acb_zeta)\n\n");
+            printf("iter = %ld, K = %ld, prec = %ld\n\n", iter, K, prec);
+            printf("s = "); acb_printd(s, 30); printf("\n\n");
+            printf("z1 = "); acb_printd(z1, 30); printf("\n\n");
+            abort();
+        }
+
+        acb_clear(s);
+        acb_clear(a);
+        acb_clear(z1);
+        acb_clear(z2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,174 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "acb.h"
+
+void acb_gamma_stirling_choose_param(int * reflect, long * r, long * n,
+    const acb_t z, int use_reflect, int digamma, long prec);
+
+void _acb_gamma_stirling(acb_t y, const acb_t x, int reflect, long r, long n,
+    arb_srcptr c, long prec, int inverse);
+
+void _acb_lgamma_stirling(acb_t y, const acb_t x, long r, long n,
+    arb_srcptr c, long prec);
+
+typedef struct
+{
+    acb_ptr res;
+    acb_srcptr x;
+    const int * reflect;
+    const long * r;
+    const long * n;
+    arb_srcptr c;
+    long start;
+    long stop;
+    long prec;
+    int lgamma;
+}
+vec_gamma_arg_t;
+
+static void
+_acb_vec_gamma_range(vec_gamma_arg_t * arg)
+{
+    long i;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        if (arg->lgamma)
+            _acb_lgamma_stirling(arg->res + i, arg->x + i,
+                arg->r[i], arg->n[i], arg->c, arg->prec);
+        else
+            _acb_gamma_stirling(arg->res + i, arg->x + i, arg->reflect[i],
+                arg->r[i], arg->n[i], arg->c, arg->prec, 0);
+    }
+}
+
+static void *
+_acb_vec_gamma_thread(void * arg_ptr)
+{
+    _acb_vec_gamma_range((vec_gamma_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_acb_vec_gamma_generic(acb_ptr res, acb_srcptr x, long len, long prec,
+    int lgamma)
+{
+    vec_gamma_arg_t * args;
+    pthread_t * threads;
+    arb_srcptr c;
+    int * reflect;
+    long * r, * n;
+    double * cost;
+    long i, j, wp, nmax, num_threads;
+
+    if (len < 1)
+        return;
+
+    wp = prec + FLINT_BIT_COUNT(prec);
+
+    reflect = flint_malloc(sizeof(int) * len);
+    r = flint_malloc(sizeof(long) * len);
+    n = flint_malloc(sizeof(long) * len);
+    cost = flint_malloc(sizeof(double) * (len + 1));
+
+    /* choose the shift r and the number of terms n for all arguments;
+       the cost is estimated as the number of multiplications */
+    nmax = 1;
+    cost[0] = 0.0;
+    for (i = 0; i < len; i++)
+    {
+        acb_gamma_stirling_choose_param(reflect + i, r + i, n + i,
+            x + i, !lgamma, 0, wp);
+        nmax = FLINT_MAX(nmax, n[i]);
+        cost[i + 1] = cost[i] + r[i] + n[i] + 10;
+    }
+
+    /* the Stirling coefficients are converted once, in this thread;
+       the worker threads only read them */
+    c = NULL;
+    if (wp <= ARB_GAMMA_STIRLING_CACHE_MAX_PREC)
+        c = arb_gamma_stirling_coeffs_cached(nmax, 0, wp);
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+    num_threads = FLINT_MAX(num_threads, 1);
+
+    args = flint_malloc(sizeof(vec_gamma_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    /* contiguous ranges of roughly equal estimated cost */
+    for (i = 0, j = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].x = x;
+        args[i].reflect = reflect;
+        args[i].r = r;
+        args[i].n = n;
+        args[i].c = c;
+        args[i].prec = prec;
+        args[i].lgamma = lgamma;
+        args[i].start = j;
+
+        while (j < len && cost[j] < (cost[len] * (i + 1)) / num_threads)
+            j++;
+
+        args[i].stop = (i == num_threads - 1) ? len : j;
+    }
+
+    if (num_threads == 1)
+    {
+        _acb_vec_gamma_range(&args[0]);
+    }
+    else
+    {
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _acb_vec_gamma_thread, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+    }
+
+    flint_free(args);
+    flint_free(threads);
+    flint_free(reflect);
+    flint_free(r);
+    flint_free(n);
+    flint_free(cost);
+}
+
+void
+_acb_vec_gamma(acb_ptr res, acb_srcptr x, long len, long prec)
+{
+    _acb_vec_gamma_generic(res, x, len, prec, 0);
+}
+
+void
+_acb_vec_lgamma(acb_ptr res, acb_srcptr x, long len, long prec)
+{
+    _acb_vec_gamma_generic(res, x, len, prec, 1);
+}
+
@@ -36,6 +36,13 @@ void
 acb_zeta(acb_t z, const acb_t s, long prec)
 {
     acb_t a;
+    long K;
+
+    /* Riemann-Siegel formula on the critical line at large height */
+    K = acb_zeta_rs_choose_k(s, prec);
+    if (K >= 0 && acb_zeta_rs(z, s, K, prec))
+        return;
+
     acb_init(a);
     acb_one(a);
 
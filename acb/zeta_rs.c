@@ -0,0 +1,473 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include <math.h>
+#include "acb.h"
+#include "arb_poly.h"
+
+/* Gabcke's bounds |R_K(t)| <= d_K (t/(2pi))^(-(2K+3)/4), valid for t >= 200 */
+static const double rs_gabcke_d[ACB_ZETA_RS_MAX_K + 1] =
+    { 0.127, 0.053, 0.011, 0.031, 0.017 };
+
+/* C_j(p) = sum of num/den * psi^(k)(p) / pi^(2e) over {j, k, num, den, e} */
+static const long rs_coeffs[][5] = {
+    { 0, 0, 1, 1, 0 },
+    { 1, 3, -1, 96, 1 },
+    { 2, 2, 1, 64, 1 },
+    { 2, 6, 1, 18432, 2 },
+    { 3, 1, -1, 64, 1 },
+    { 3, 5, -1, 3840, 2 },
+    { 3, 9, -1, 5308416, 3 },
+    { 4, 0, 1, 128, 1 },
+    { 4, 4, 19, 24576, 2 },
+    { 4, 8, 11, 5898240, 3 },
+    { 4, 12, 1, 2038431744, 4 },
+};
+
+#define RS_NUM_COEFFS (sizeof(rs_coeffs) / sizeof(rs_coeffs[0]))
+
+/* numerator cos(2 pi (p^2 - p - 1/16)) and denominator cos(2 pi p)
+   of psi(p + x) as power series in x */
+static void
+rs_psi_num_den(arb_ptr num, arb_ptr den, const arb_t p, long len, long prec)
+{
+    arb_ptr h;
+    arb_t pi, t;
+
+    h = _arb_vec_init(3);
+    arb_init(pi);
+    arb_init(t);
+
+    arb_const_pi(pi, prec);
+    arb_mul_2exp_si(pi, pi, 1);
+
+    arb_mul(h, p, p, prec);
+    arb_sub(h, h, p, prec);
+    arb_one(t);
+    arb_mul_2exp_si(t, t, -4);
+    arb_sub(h, h, t, prec);
+    arb_mul(h, h, pi, prec);
+    arb_mul_2exp_si(h + 1, p, 1);
+    arb_sub_ui(h + 1, h + 1, 1, prec);
+    arb_mul(h + 1, h + 1, pi, prec);
+    arb_set(h + 2, pi);
+    _arb_poly_cos_series(num, h, 3, len, prec);
+
+    arb_mul(h, p, pi, prec);
+    arb_set(h + 1, pi);
+    _arb_poly_cos_series(den, h, 2, len, prec);
+
+    _arb_vec_clear(h, 3);
+    arb_clear(pi);
+    arb_clear(t);
+}
+
+/* Taylor coefficients of psi at p, given p0 in {1/4, 3/4} with
+   |p - p0| <= 1/16. Both the numerator and the denominator of psi vanish
+   at p0, so we expand psi at p0 by cancelling the zeros exactly, shift
+   the expansion to p and bound the truncation error with the Cauchy
+   estimate on the circle |z - p0| = R = 1/4. */
+static void
+rs_psi_series_near(arb_ptr res, const arb_t p, const arb_t p0,
+    long len, long prec)
+{
+    arb_ptr num, den, a;
+    arb_t w, rho, r, q, u, v;
+    acb_t z, y;
+    mag_t M, E, rlow, tmp;
+    long k, m;
+
+    /* with R = 1/4 and |w| <= 1/16, rho / R <= 5/8 */
+    m = 1.48 * (prec + 4 * len + 20) + 1;
+
+    num = _arb_vec_init(m + 1);
+    den = _arb_vec_init(m + 1);
+    a = _arb_vec_init(m);
+    arb_init(w);
+    arb_init(rho);
+    arb_init(r);
+    arb_init(q);
+    arb_init(u);
+    arb_init(v);
+    acb_init(z);
+    acb_init(y);
+    mag_init(M);
+    mag_init(E);
+    mag_init(rlow);
+    mag_init(tmp);
+
+    rs_psi_num_den(num, den, p0, m + 1, prec);
+    _arb_poly_div_series(a, num + 1, m, den + 1, m, m, prec);
+
+    arb_sub(w, p, p0, prec);
+    _arb_poly_taylor_shift(a, w, m, prec);
+    _arb_vec_set(res, a, len);
+
+    /* M >= |psi| on |z - p0| = R: the numerator is bounded on a box
+       containing the circle, and |cos(2 pi z)| = |sin(2 pi (z - p0))|
+       >= 2u - sinh(u) with u = 2 pi R */
+    arb_set(acb_realref(z), p0);
+    mag_set_ui_2exp_si(arb_radref(acb_realref(z)), 1, -2);
+    mag_set_ui_2exp_si(arb_radref(acb_imagref(z)), 1, -2);
+    acb_mul(y, z, z, MAG_BITS);
+    acb_sub(y, y, z, MAG_BITS);
+    arb_one(u);
+    arb_mul_2exp_si(u, u, -4);
+    arb_sub(acb_realref(y), acb_realref(y), u, MAG_BITS);
+    arb_const_pi(u, MAG_BITS);
+    arb_mul_2exp_si(u, u, 1);
+    acb_mul_arb(y, y, u, MAG_BITS);
+    acb_cos(y, y, MAG_BITS);
+    acb_get_mag(M, y);
+
+    arb_const_pi(u, MAG_BITS);
+    arb_mul_2exp_si(u, u, -1);
+    arb_sinh(v, u, MAG_BITS);
+    arb_mul_2exp_si(u, u, 1);
+    arb_sub(u, u, v, MAG_BITS);
+    arb_get_mag_lower(tmp, u);
+    mag_div(M, M, tmp);
+
+    /* rho = (R + |w|) / 2, r = (R - |w|) / 2, q = rho / R */
+    arb_get_mag(tmp, w);
+    arf_set_mag(arb_midref(u), tmp);
+    mag_zero(arb_radref(u));
+    arb_one(v);
+    arb_mul_2exp_si(v, v, -2);
+    arb_add(rho, v, u, MAG_BITS);
+    arb_mul_2exp_si(rho, rho, -1);
+    arb_sub(r, v, u, MAG_BITS);
+    arb_mul_2exp_si(r, r, -1);
+    arb_mul_2exp_si(q, rho, 2);
+
+    /* |psi - truncation| <= M q^m / (1 - q) on |z - p| = r */
+    arb_get_mag(tmp, q);
+    mag_pow_ui(E, tmp, m);
+    mag_mul(E, E, M);
+    arb_sub_ui(u, q, 1, MAG_BITS);
+    arb_neg(u, u);
+    arb_get_mag_lower(tmp, u);
+    mag_div(E, E, tmp);
+    arb_get_mag_lower(rlow, r);
+
+    for (k = 0; k < len; k++)
+    {
+        arb_add_error_mag(res + k, E);
+        mag_div(E, E, rlow);
+    }
+
+    _arb_vec_clear(num, m + 1);
+    _arb_vec_clear(den, m + 1);
+    _arb_vec_clear(a, m);
+    arb_clear(w);
+    arb_clear(rho);
+    arb_clear(r);
+    arb_clear(q);
+    arb_clear(u);
+    arb_clear(v);
+    acb_clear(z);
+    acb_clear(y);
+    mag_clear(M);
+    mag_clear(E);
+    mag_clear(rlow);
+    mag_clear(tmp);
+}
+
+/* Taylor coefficients of psi(p) = cos(2 pi (p^2 - p - 1/16)) / cos(2 pi p),
+   for 0 <= p <= 1 */
+static void
+rs_psi_series(arb_ptr res, const arb_t p, long len, long prec)
+{
+    arb_t p0, w;
+    int near;
+
+    arb_init(p0);
+    arb_init(w);
+
+    arb_set_ui(p0, 1 + 2 * (arf_cmp_2exp_si(arb_midref(p), -1) >= 0));
+    arb_mul_2exp_si(p0, p0, -2);
+    /* |p - p0| <= 1/16 */
+    arb_sub(w, p, p0, prec);
+    arb_abs(w, w);
+    arb_mul_2exp_si(w, w, 4);
+    arb_sub_ui(w, w, 1, prec);
+    near = arb_is_nonpositive(w);
+
+    if (near)
+    {
+        rs_psi_series_near(res, p, p0, len, prec);
+    }
+    else
+    {
+        arb_ptr num, den;
+
+        num = _arb_vec_init(len);
+        den = _arb_vec_init(len);
+
+        rs_psi_num_den(num, den, p, len, prec);
+        _arb_poly_div_series(res, num, len, den, len, len, prec);
+
+        _arb_vec_clear(num, len);
+        _arb_vec_clear(den, len);
+    }
+
+    arb_clear(p0);
+    arb_clear(w);
+}
+
+long
+acb_zeta_rs_choose_k(const acb_t s, long prec)
+{
+    arf_t u;
+    double tl, logtau;
+    long K;
+
+    if (!arb_is_exact(acb_realref(s)) ||
+        arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) != 0 ||
+        !arb_is_finite(acb_imagref(s)))
+        return -1;
+
+    arf_init(u);
+    arf_set_mag(u, arb_radref(acb_imagref(s)));
+    arf_sub(u, arb_midref(acb_imagref(s)), u, 30, ARF_RND_FLOOR);
+    tl = arf_get_d(u, ARF_RND_DOWN);
+
+    if (tl < 200)
+    {
+        arf_set_mag(u, arb_radref(acb_imagref(s)));
+        arf_add(u, arb_midref(acb_imagref(s)), u, 30, ARF_RND_CEIL);
+        tl = -arf_get_d(u, ARF_RND_UP);
+    }
+
+    arf_clear(u);
+
+    if (!(tl >= 200))
+        return -1;
+
+    logtau = log(tl / 6.283185307179586) / log(2.0);
+
+    for (K = 0; K <= ACB_ZETA_RS_MAX_K; K++)
+    {
+        if (log(rs_gabcke_d[K]) / log(2.0) - (2 * K + 3) * 0.25 * logtau
+                < -prec)
+            return K;
+    }
+
+    return -1;
+}
+
+int
+_acb_zeta_rs_correction(arb_t r, long * N, const arb_t t, long K, long prec)
+{
+    arb_t tau, sq, p, v, w, pi;
+    arb_ptr psi;
+    arf_t lo, hi;
+    mag_t err, d;
+    long j, i, wp, len;
+    int success;
+
+    arb_init(tau);
+    arb_init(sq);
+    arb_init(p);
+    arb_init(v);
+    arb_init(w);
+    arb_init(pi);
+    arf_init(lo);
+    arf_init(hi);
+    mag_init(err);
+    mag_init(d);
+
+    /* require t >= 200 on the whole ball */
+    arb_sub_ui(v, t, 200, 30);
+    success = arb_is_nonnegative(v);
+
+    if (success)
+    {
+        arb_get_abs_ubound_arf(hi, t, 30);
+        wp = prec + arf_abs_bound_lt_2exp_si(hi) + 10;
+
+        arb_const_pi(pi, wp);
+
+        /* tau = t / (2 pi), N = floor(sqrt(tau)), p = sqrt(tau) - N */
+        arb_div(tau, t, pi, wp);
+        arb_mul_2exp_si(tau, tau, -1);
+        arb_sqrt(sq, tau, wp);
+
+        arf_set_mag(hi, arb_radref(sq));
+        arf_sub(lo, arb_midref(sq), hi, wp, ARF_RND_FLOOR);
+        arf_add(hi, arb_midref(sq), hi, wp, ARF_RND_CEIL);
+        *N = arf_get_si(lo, ARF_RND_FLOOR);
+        success = (*N == arf_get_si(hi, ARF_RND_FLOOR));
+    }
+
+    if (success)
+    {
+        arb_sub_ui(p, sq, *N, wp);
+
+        /* correction terms sum_{j=0}^K C_j(p) tau^(-j/2) */
+        len = 3 * K + 1;
+        psi = _arb_vec_init(len);
+        rs_psi_series(psi, p, len, wp);
+
+        /* psi^(k)(p) = k! times the Taylor coefficient */
+        arb_one(v);
+        for (i = 2; i < len; i++)
+        {
+            arb_mul_ui(v, v, i, wp);
+            arb_mul(psi + i, psi + i, v, wp);
+        }
+
+        /* v = sum of C_j tau^(-j/2), by Horner in tau^(-1/2) */
+        arb_rsqrt(sq, tau, wp);
+        arb_zero(v);
+        for (j = K; j >= 0; j--)
+        {
+            arb_mul(v, v, sq, wp);
+
+            for (i = 0; i < RS_NUM_COEFFS; i++)
+            {
+                if (rs_coeffs[i][0] == j)
+                {
+                    arb_mul_si(w, psi + rs_coeffs[i][1], rs_coeffs[i][2], wp);
+                    arb_div_ui(w, w, rs_coeffs[i][3], wp);
+                    if (rs_coeffs[i][4] != 0)
+                    {
+                        arb_pow_ui(p, pi, 2 * rs_coeffs[i][4], wp);
+                        arb_div(w, w, p, wp);
+                    }
+                    arb_add(v, v, w, wp);
+                }
+            }
+        }
+
+        /* (-1)^(N-1) tau^(-1/4) */
+        arb_sqrt(sq, sq, wp);
+        arb_mul(r, v, sq, prec);
+        if (*N % 2 == 0)
+            arb_neg(r, r);
+
+        /* remainder bound d_K tau^(-(2K+3)/4) */
+        arb_set_si(w, -(2 * K + 3));
+        arb_mul_2exp_si(w, w, -2);
+        arb_pow(w, tau, w, MAG_BITS);
+        arb_get_mag(err, w);
+        mag_set_d(d, rs_gabcke_d[K]);
+        mag_mul(err, err, d);
+        arb_add_error_mag(r, err);
+
+        _arb_vec_clear(psi, len);
+    }
+
+    arb_clear(tau);
+    arb_clear(sq);
+    arb_clear(p);
+    arb_clear(v);
+    arb_clear(w);
+    arb_clear(pi);
+    arf_clear(lo);
+    arf_clear(hi);
+    mag_clear(err);
+    mag_clear(d);
+
+    return success;
+}
+
+int
+acb_zeta_rs(acb_t z, const acb_t s, long K, long prec)
+{
+    arb_t t, theta, logn, v, w, Z, R;
+    arf_t hi;
+    long N, n, wp;
+    int conj, success;
+
+    if (K < 0 || K > ACB_ZETA_RS_MAX_K)
+    {
+        printf("acb_zeta_rs: require 0 <= K <= %d\n", ACB_ZETA_RS_MAX_K);
+        abort();
+    }
+
+    if (!arb_is_exact(acb_realref(s)) ||
+        arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) != 0 ||
+        !arb_is_finite(acb_imagref(s)))
+        return 0;
+
+    arb_init(t);
+    arb_init(theta);
+    arb_init(logn);
+    arb_init(v);
+    arb_init(w);
+    arb_init(Z);
+    arb_init(R);
+    arf_init(hi);
+
+    conj = arf_sgn(arb_midref(acb_imagref(s))) < 0;
+    arb_abs(t, acb_imagref(s));
+
+    /* t log(n) must be accurate to prec bits */
+    arb_get_abs_ubound_arf(hi, t, 30);
+    wp = prec + 2 * arf_abs_bound_lt_2exp_si(hi) + 10;
+
+    success = _acb_zeta_rs_correction(R, &N, t, K, wp);
+
+    if (success)
+    {
+        /* theta(t) */
+        _arb_poly_riemann_siegel_theta_series(theta, t, 1, 1, wp);
+
+        /* main sum 2 sum_{n=1}^N n^(-1/2) cos(theta - t log(n)) */
+        arb_cos(Z, theta, wp);
+        for (n = 2; n <= N; n++)
+        {
+            arb_log_ui_from_prev(logn, n, logn, n - 1, wp);
+            arb_mul(v, t, logn, wp);
+            arb_sub(v, theta, v, wp);
+            arb_cos(v, v, wp);
+            arb_rsqrt_ui(w, n, wp);
+            arb_addmul(Z, v, w, wp);
+        }
+        arb_mul_2exp_si(Z, Z, 1);
+
+        arb_add(Z, Z, R, wp);
+
+        /* zeta(1/2 + it) = exp(-i theta(t)) Z(t) */
+        arb_sin_cos(w, v, theta, wp);
+        arb_mul(acb_realref(z), Z, v, prec);
+        arb_mul(acb_imagref(z), Z, w, prec);
+        if (!conj)
+            arb_neg(acb_imagref(z), acb_imagref(z));
+    }
+
+    arb_clear(t);
+    arb_clear(theta);
+    arb_clear(logn);
+    arb_clear(v);
+    arb_clear(w);
+    arb_clear(Z);
+    arb_clear(R);
+    arf_clear(hi);
+
+    return success;
+}
@@ -53,6 +53,28 @@ int acb_calc_integrate_taylor(acb_t res,
     const arf_t outer_radius,
     long accuracy_goal, long prec);
 
+int acb_calc_integrate_gl(acb_t res,
+    acb_calc_func_t func, void * param,
+    const acb_t a, const acb_t b,
+    const arf_t outer_radius,
+    long accuracy_goal, long deg_limit, long maxdepth, long prec);
+
+/* Gauss-Legendre nodes */
+
+void acb_calc_gl_nodes(arb_ptr xs, arb_ptr ws, long n, long prec);
+
+#define ACB_CALC_GL_CACHE_DEFAULT_SIZE 32
+
+void acb_calc_gl_nodes_cached(arb_ptr xs, arb_ptr ws, long n, long prec);
+
+void acb_calc_gl_cache_clear(void);
+
+void acb_calc_gl_cache_set_size(long size);
+
+int acb_calc_gl_cache_save(const char * filename);
+
+int acb_calc_gl_cache_load(const char * filename);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,30 +24,83 @@
 ******************************************************************************/
 
 #include "acb_calc.h"
+#include "pthread.h"
+
+typedef struct
+{
+    acb_calc_func_t func;
+    void * param;
+    acb_srcptr x;
+    arb_srcptr radius;
+    arb_srcptr c;
+    arb_srcptr s;
+    long start;
+    long stop;
+    long prec;
+    arb_ptr sum;
+}
+cauchy_bound_arg_t;
+
+/* sets sum to the sum of |f| over the arcs start, ..., stop - 1, where
+   c and s hold the cosines and sines of the arc endpoints */
+static void
+_cauchy_bound_sum(arb_t sum, acb_calc_func_t func, void * param,
+    const acb_t x, const arb_t radius, arb_srcptr c, arb_srcptr s,
+    long start, long stop, long prec)
+{
+    acb_t t, u;
+    arb_t v;
+    long i;
+
+    acb_init(t);
+    acb_init(u);
+    arb_init(v);
+
+    arb_zero(sum);
+
+    for (i = start; i < stop; i++)
+    {
+        /* since we use power of two subdivision points, the
+           sine and cosine are monotone on each subinterval */
+        arb_union(acb_realref(t), c + i, c + i + 1, prec + 20);
+        arb_union(acb_imagref(t), s + i, s + i + 1, prec + 20);
+        acb_mul_arb(t, t, radius, prec + 20);
+        acb_add(t, t, x, prec);
+
+        func(u, t, param, 1, prec);
+        acb_abs(v, u, prec);
+        arb_add(sum, sum, v, prec);
+    }
+
+    acb_clear(t);
+    acb_clear(u);
+    arb_clear(v);
+}
+
+static void *
+_cauchy_bound_thread(void * arg_ptr)
+{
+    cauchy_bound_arg_t arg = *((cauchy_bound_arg_t *) arg_ptr);
+
+    _cauchy_bound_sum(arg.sum, arg.func, arg.param, arg.x, arg.radius,
+        arg.c, arg.s, arg.start, arg.stop, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
 
 void
 acb_calc_cauchy_bound(arb_t bound, acb_calc_func_t func, void * param,
     const acb_t x, const arb_t radius, long maxdepth, long prec)
 {
-    long i, n, depth, wp;
-
-    arb_t pi, theta, v, s1, c1, s2, c2, st, ct;
-    acb_t t, u;
-    arb_t b;
+    long i, n, depth, wp, num_threads;
+    arb_ptr c, s, c2, s2;
+    arb_t pi, theta, st, ct, b;
 
     arb_init(pi);
     arb_init(theta);
-    arb_init(v);
-
-    arb_init(s1);
-    arb_init(c1);
-    arb_init(s2);
-    arb_init(c2);
     arb_init(st);
     arb_init(ct);
-
-    acb_init(t);
-    acb_init(u);
     arb_init(b);
 
     wp = prec + 20;
@@ -55,45 +108,92 @@ acb_calc_cauchy_bound(arb_t bound, acb_calc_func_t func, void * param,
     arb_const_pi(pi, wp);
     arb_zero_pm_inf(b);
 
-    for (depth = 0, n = 16; depth < maxdepth; n *= 2, depth++)
-    {
-        arb_zero(b);
+    /* cosines and sines of the endpoints 2 pi i / n, 0 <= i <= n */
+    n = 1;
+    c = _arb_vec_init(n + 1);
+    s = _arb_vec_init(n + 1);
+    arb_one(c + 0);
+    arb_one(c + 1);
 
-        /* theta = 2 pi / n */
-        arb_div_ui(theta, pi, n, wp);
-        arb_mul_2exp_si(theta, theta, 1);
+    for (depth = 0; depth < maxdepth; depth++)
+    {
+        /* double the number of arcs until n = 16 * 2^depth, keeping the
+           old endpoints and rotating each of them by 2 pi / (2n) to
+           obtain the new ones */
+        while (n < (16L << depth))
+        {
+            arb_div_ui(theta, pi, n, wp);
+            arb_sin_cos(st, ct, theta, wp);
+
+            c2 = _arb_vec_init(2 * n + 1);
+            s2 = _arb_vec_init(2 * n + 1);
+
+            for (i = 0; i < n; i++)
+            {
+                arb_swap(c2 + 2 * i, c + i);
+                arb_swap(s2 + 2 * i, s + i);
+
+                arb_mul(c2 + 2 * i + 1, c2 + 2 * i, ct, wp);
+                arb_submul(c2 + 2 * i + 1, s2 + 2 * i, st, wp);
+                arb_mul(s2 + 2 * i + 1, s2 + 2 * i, ct, wp);
+                arb_addmul(s2 + 2 * i + 1, c2 + 2 * i, st, wp);
+            }
+
+            arb_swap(c2 + 2 * n, c + n);
+            arb_swap(s2 + 2 * n, s + n);
+
+            _arb_vec_clear(c, n + 1);
+            _arb_vec_clear(s, n + 1);
+            c = c2;
+            s = s2;
+            n *= 2;
+        }
 
-        /* sine and cosine of i*theta and (i+1)*theta */
-        arb_zero(s1);
-        arb_one(c1);
-        arb_sin_cos(st, ct, theta, wp);
-        arb_set(s2, st);
-        arb_set(c2, ct);
+        num_threads = FLINT_MIN(flint_get_num_threads(), n);
 
-        for (i = 0; i < n; i++)
+        if (num_threads > 1)
         {
-            /* sine and cosine of 2 pi ([i,i+1]/n) */
-
-            /* since we use power of two subdivision points, the
-               sine and cosine are monotone on each subinterval */
-            arb_union(acb_realref(t), c1, c2, wp);
-            arb_union(acb_imagref(t), s1, s2, wp);
-            acb_mul_arb(t, t, radius, wp);
-            acb_add(t, t, x, prec);
-
-            /* next angle */
-            arb_mul(v, c2, ct, wp);
-            arb_mul(c1, s2, st, wp);
-            arb_sub(c1, v, c1, wp);
-            arb_mul(v, c2, st, wp);
-            arb_mul(s1, s2, ct, wp);
-            arb_add(s1, v, s1, wp);
-            arb_swap(c1, c2);
-            arb_swap(s1, s2);
-
-            func(u, t, param, 1, prec);
-            acb_abs(v, u, prec);
-            arb_add(b, b, v, prec);
+            /* the function evaluations are independent; each thread
+               sums a contiguous range of arcs */
+            pthread_t * threads;
+            cauchy_bound_arg_t * args;
+            arb_ptr sums;
+
+            threads = flint_malloc(sizeof(pthread_t) * num_threads);
+            args = flint_malloc(sizeof(cauchy_bound_arg_t) * num_threads);
+            sums = _arb_vec_init(num_threads);
+
+            for (i = 0; i < num_threads; i++)
+            {
+                args[i].func = func;
+                args[i].param = param;
+                args[i].x = x;
+                args[i].radius = radius;
+                args[i].c = c;
+                args[i].s = s;
+                args[i].start = (n * i) / num_threads;
+                args[i].stop = (n * (i + 1)) / num_threads;
+                args[i].prec = prec;
+                args[i].sum = sums + i;
+
+                pthread_create(&threads[i], NULL,
+                    _cauchy_bound_thread, &args[i]);
+            }
+
+            for (i = 0; i < num_threads; i++)
+                pthread_join(threads[i], NULL);
+
+            arb_zero(b);
+            for (i = 0; i < num_threads; i++)
+                arb_add(b, b, sums + i, prec);
+
+            _arb_vec_clear(sums, num_threads);
+            flint_free(threads);
+            flint_free(args);
+        }
+        else
+        {
+            _cauchy_bound_sum(b, func, param, x, radius, c, s, 0, n, prec);
         }
 
         arb_div_ui(b, b, n, prec);
@@ -104,19 +204,12 @@ acb_calc_cauchy_bound(arb_t bound, acb_calc_func_t func, void * param,
 
     arb_set(bound, b);
 
+    _arb_vec_clear(c, n + 1);
+    _arb_vec_clear(s, n + 1);
+
     arb_clear(pi);
     arb_clear(theta);
-    arb_clear(v);
-
-    acb_clear(t);
-    acb_clear(u);
-    arb_clear(b);
-
-    arb_clear(s1);
-    arb_clear(c1);
-    arb_clear(s2);
-    arb_clear(c2);
     arb_clear(st);
     arb_clear(ct);
+    arb_clear(b);
 }
-
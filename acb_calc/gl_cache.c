@@ -0,0 +1,337 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include <string.h>
+#include "acb_calc.h"
+
+typedef struct
+{
+    long n;
+    long prec;
+    ulong tick;
+    arb_ptr xs;
+    arb_ptr ws;
+}
+gl_cache_entry_struct;
+
+static TLS_PREFIX gl_cache_entry_struct * gl_cache = NULL;
+static TLS_PREFIX long gl_cache_len = 0;
+static TLS_PREFIX long gl_cache_alloc = 0;
+static TLS_PREFIX long gl_cache_size = ACB_CALC_GL_CACHE_DEFAULT_SIZE;
+static TLS_PREFIX ulong gl_cache_tick = 0;
+static TLS_PREFIX int gl_cache_registered = 0;
+
+static void
+gl_cache_entry_clear(gl_cache_entry_struct * entry)
+{
+    _arb_vec_clear(entry->xs, entry->n);
+    _arb_vec_clear(entry->ws, entry->n);
+}
+
+/* removes the least recently used entry */
+static void
+gl_cache_evict(void)
+{
+    long i, j;
+
+    for (i = j = 0; i < gl_cache_len; i++)
+        if (gl_cache[i].tick < gl_cache[j].tick)
+            j = i;
+
+    gl_cache_entry_clear(gl_cache + j);
+    gl_cache[j] = gl_cache[gl_cache_len - 1];
+    gl_cache_len--;
+}
+
+void
+acb_calc_gl_cache_clear(void)
+{
+    long i;
+
+    for (i = 0; i < gl_cache_len; i++)
+        gl_cache_entry_clear(gl_cache + i);
+
+    flint_free(gl_cache);
+    gl_cache = NULL;
+    gl_cache_len = 0;
+    gl_cache_alloc = 0;
+}
+
+void
+acb_calc_gl_cache_set_size(long size)
+{
+    size = FLINT_MAX(size, 0);
+
+    while (gl_cache_len > size)
+        gl_cache_evict();
+
+    gl_cache_size = size;
+}
+
+/* returns an empty entry for (n, prec), replacing any entry with the
+   same degree and evicting the least recently used entry if full */
+static gl_cache_entry_struct *
+gl_cache_insert(long n, long prec)
+{
+    gl_cache_entry_struct * entry;
+    long i;
+
+    if (!gl_cache_registered)
+    {
+        flint_register_cleanup_function(acb_calc_gl_cache_clear);
+        gl_cache_registered = 1;
+    }
+
+    for (i = 0; i < gl_cache_len; i++)
+    {
+        if (gl_cache[i].n == n)
+        {
+            gl_cache_entry_clear(gl_cache + i);
+            gl_cache[i] = gl_cache[gl_cache_len - 1];
+            gl_cache_len--;
+            break;
+        }
+    }
+
+    if (gl_cache_len >= gl_cache_size)
+        gl_cache_evict();
+
+    if (gl_cache_len >= gl_cache_alloc)
+    {
+        gl_cache_alloc = FLINT_MAX(2 * gl_cache_alloc, 4);
+        gl_cache = flint_realloc(gl_cache,
+            sizeof(gl_cache_entry_struct) * gl_cache_alloc);
+    }
+
+    entry = gl_cache + gl_cache_len;
+    gl_cache_len++;
+
+    entry->n = n;
+    entry->prec = prec;
+    entry->tick = gl_cache_tick++;
+    entry->xs = _arb_vec_init(n);
+    entry->ws = _arb_vec_init(n);
+
+    return entry;
+}
+
+void
+acb_calc_gl_nodes_cached(arb_ptr xs, arb_ptr ws, long n, long prec)
+{
+    gl_cache_entry_struct * entry;
+    long i;
+
+    if (gl_cache_size == 0)
+    {
+        acb_calc_gl_nodes(xs, ws, n, prec);
+        return;
+    }
+
+    entry = NULL;
+
+    for (i = 0; i < gl_cache_len; i++)
+    {
+        if (gl_cache[i].n == n && gl_cache[i].prec >= prec)
+        {
+            entry = gl_cache + i;
+            entry->tick = gl_cache_tick++;
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        entry = gl_cache_insert(n, prec);
+        acb_calc_gl_nodes(entry->xs, entry->ws, n, prec);
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        arb_set_round(xs + i, entry->xs + i, prec);
+        arb_set_round(ws + i, entry->ws + i, prec);
+    }
+}
+
+/* binary format: the magic string, followed by entries consisting of
+   n and prec, then the nodes and weights, each arb_t being written as
+   the mantissas and exponents of its midpoint and radius; all integers
+   are written with fmpz_out_raw */
+
+#define GL_CACHE_MAGIC "arb-gl-cache-1\n"
+
+static int
+gl_write_arb(FILE * fp, const arb_t x, fmpz_t man, fmpz_t exp, arf_t t)
+{
+    int ok = 1;
+
+    arf_get_fmpz_2exp(man, exp, arb_midref(x));
+    ok = ok && fmpz_out_raw(fp, man) != 0;
+    ok = ok && fmpz_out_raw(fp, exp) != 0;
+    arf_set_mag(t, arb_radref(x));
+    arf_get_fmpz_2exp(man, exp, t);
+    ok = ok && fmpz_out_raw(fp, man) != 0;
+    ok = ok && fmpz_out_raw(fp, exp) != 0;
+
+    return ok;
+}
+
+static int
+gl_read_arb(FILE * fp, arb_t x, fmpz_t man, fmpz_t exp, arf_t t)
+{
+    if (fmpz_inp_raw(man, fp) == 0 || fmpz_inp_raw(exp, fp) == 0)
+        return 0;
+    arf_set_fmpz_2exp(arb_midref(x), man, exp);
+
+    if (fmpz_inp_raw(man, fp) == 0 || fmpz_inp_raw(exp, fp) == 0)
+        return 0;
+    arf_set_fmpz_2exp(t, man, exp);
+
+    if (arf_sgn(t) < 0)
+        return 0;
+    arf_get_mag(arb_radref(x), t);
+
+    return 1;
+}
+
+int
+acb_calc_gl_cache_save(const char * filename)
+{
+    FILE * fp;
+    fmpz_t man, exp;
+    arf_t t;
+    long i, j;
+    int ok;
+
+    fp = fopen(filename, "wb");
+    if (fp == NULL)
+        return 0;
+
+    fmpz_init(man);
+    fmpz_init(exp);
+    arf_init(t);
+
+    ok = (fputs(GL_CACHE_MAGIC, fp) >= 0);
+
+    for (i = 0; i < gl_cache_len && ok; i++)
+    {
+        fmpz_set_si(man, gl_cache[i].n);
+        ok = ok && fmpz_out_raw(fp, man) != 0;
+        fmpz_set_si(man, gl_cache[i].prec);
+        ok = ok && fmpz_out_raw(fp, man) != 0;
+
+        for (j = 0; j < gl_cache[i].n && ok; j++)
+        {
+            ok = ok && gl_write_arb(fp, gl_cache[i].xs + j, man, exp, t);
+            ok = ok && gl_write_arb(fp, gl_cache[i].ws + j, man, exp, t);
+        }
+    }
+
+    ok = (fclose(fp) == 0) && ok;
+
+    fmpz_clear(man);
+    fmpz_clear(exp);
+    arf_clear(t);
+
+    return ok;
+}
+
+int
+acb_calc_gl_cache_load(const char * filename)
+{
+    FILE * fp;
+    fmpz_t man, exp;
+    arf_t t;
+    arb_ptr xs, ws;
+    char magic[sizeof(GL_CACHE_MAGIC)];
+    long n, prec, j;
+    int ok, c;
+
+    fp = fopen(filename, "rb");
+    if (fp == NULL)
+        return 0;
+
+    fmpz_init(man);
+    fmpz_init(exp);
+    arf_init(t);
+
+    ok = (fread(magic, 1, sizeof(GL_CACHE_MAGIC) - 1, fp)
+            == sizeof(GL_CACHE_MAGIC) - 1)
+        && memcmp(magic, GL_CACHE_MAGIC, sizeof(GL_CACHE_MAGIC) - 1) == 0;
+
+    while (ok && (c = getc(fp)) != EOF)
+    {
+        ungetc(c, fp);
+
+        ok = fmpz_inp_raw(man, fp) != 0 && fmpz_fits_si(man)
+                && fmpz_sgn(man) > 0;
+        if (!ok)
+            break;
+        n = fmpz_get_si(man);
+
+        ok = fmpz_inp_raw(man, fp) != 0 && fmpz_fits_si(man)
+                && fmpz_sgn(man) > 0;
+        if (!ok)
+            break;
+        prec = fmpz_get_si(man);
+
+        xs = _arb_vec_init(n);
+        ws = _arb_vec_init(n);
+
+        for (j = 0; j < n && ok; j++)
+        {
+            ok = ok && gl_read_arb(fp, xs + j, man, exp, t);
+            ok = ok && gl_read_arb(fp, ws + j, man, exp, t);
+        }
+
+        /* keep the entry unless a better one is already present */
+        if (ok && gl_cache_size > 0)
+        {
+            gl_cache_entry_struct * entry;
+
+            for (j = 0; j < gl_cache_len; j++)
+                if (gl_cache[j].n == n && gl_cache[j].prec >= prec)
+                    break;
+
+            if (j == gl_cache_len)
+            {
+                entry = gl_cache_insert(n, prec);
+                _arb_vec_swap(entry->xs, xs, n);
+                _arb_vec_swap(entry->ws, ws, n);
+            }
+        }
+
+        _arb_vec_clear(xs, n);
+        _arb_vec_clear(ws, n);
+    }
+
+    fclose(fp);
+
+    fmpz_clear(man);
+    fmpz_clear(exp);
+    arf_clear(t);
+
+    return ok;
+}
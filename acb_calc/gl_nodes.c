@@ -0,0 +1,235 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include <math.h>
+#include "acb_calc.h"
+
+/* maximum number of times the working precision is doubled before
+   giving up on certifying the nodes */
+#define GL_MAX_DOUBLINGS 8
+
+/* evaluates the Legendre polynomial P_n and its derivative using
+   the three-term recurrences
+   (k+1) P_{k+1} = (2k+1) x P_k - k P_{k-1},
+   P'_{k+1} = P'_{k-1} + (2k+1) P_k */
+static void
+legendre_eval(arb_t p, arb_t dp, const arb_t x, long n, long prec)
+{
+    arb_t p0, p1, d0, d1, t;
+    long k;
+
+    if (n == 0)
+    {
+        arb_one(p);
+        arb_zero(dp);
+        return;
+    }
+
+    arb_init(p0);
+    arb_init(p1);
+    arb_init(d0);
+    arb_init(d1);
+    arb_init(t);
+
+    arb_one(p0);
+    arb_set(p1, x);
+    arb_zero(d0);
+    arb_one(d1);
+
+    for (k = 1; k < n; k++)
+    {
+        arb_mul(t, p1, x, prec);
+        arb_mul_ui(t, t, 2 * k + 1, prec);
+        arb_submul_ui(t, p0, k, prec);
+        arb_div_ui(t, t, k + 1, prec);
+
+        arb_addmul_ui(d0, p1, 2 * k + 1, prec);
+
+        arb_swap(p0, p1);
+        arb_swap(p1, t);
+        arb_swap(d0, d1);
+    }
+
+    arb_set(p, p1);
+    arb_set(dp, d1);
+
+    arb_clear(p0);
+    arb_clear(p1);
+    arb_clear(d0);
+    arb_clear(d1);
+    arb_clear(t);
+}
+
+/* computes an enclosure of the root of P_n closest to x0;
+   returns 0 if the root could not be certified */
+static int
+legendre_root(arb_t res, double x0, long n, long wp)
+{
+    arb_t x, p, dp, X;
+    mag_t r;
+    long precs[FLINT_BITS];
+    long i, num;
+    int success;
+
+    arb_init(x);
+    arb_init(p);
+    arb_init(dp);
+    arb_init(X);
+    mag_init(r);
+
+    precs[0] = wp;
+    for (num = 1; precs[num - 1] > 48; num++)
+        precs[num] = precs[num - 1] / 2 + 8;
+
+    arf_set_d(arb_midref(x), x0);
+
+    /* Newton iteration on midpoints with precision doubling */
+    for (i = num - 1; i >= 0; i--)
+    {
+        long iters = (i == num - 1) ? 4 : 1;
+
+        while (iters-- > 0)
+        {
+            legendre_eval(p, dp, x, n, precs[i]);
+            arb_div(p, p, dp, precs[i]);
+            arb_sub(x, x, p, precs[i]);
+            mag_zero(arb_radref(x));
+        }
+    }
+
+    /* certification by the interval Newton operator */
+    success = 0;
+    mag_set_ui_2exp_si(r, 1, -wp + 8);
+
+    for (i = 0; i < 4 && !success; i++)
+    {
+        arb_set(X, x);
+        mag_set(arb_radref(X), r);
+
+        legendre_eval(p, dp, X, n, wp);
+
+        if (arb_is_finite(dp) && !arb_contains_zero(dp))
+        {
+            arb_set(res, dp);
+            legendre_eval(p, dp, x, n, wp);
+            arb_div(p, p, res, wp);
+            arb_sub(res, x, p, wp);
+            success = arb_contains(X, res);
+        }
+
+        mag_mul_2exp_si(r, r, 8);
+    }
+
+    arb_clear(x);
+    arb_clear(p);
+    arb_clear(dp);
+    arb_clear(X);
+    mag_clear(r);
+
+    return success;
+}
+
+void
+acb_calc_gl_nodes(arb_ptr xs, arb_ptr ws, long n, long prec)
+{
+    arb_t p, dp, t;
+    long i, m, wp, attempt;
+    int success;
+
+    if (n < 1)
+    {
+        printf("acb_calc_gl_nodes: require n >= 1\n");
+        abort();
+    }
+
+    arb_init(p);
+    arb_init(dp);
+    arb_init(t);
+
+    m = n / 2;
+
+    wp = prec + 2 * FLINT_BIT_COUNT(n) + 20;
+
+    for (attempt = 0; ; attempt++)
+    {
+        if (attempt > GL_MAX_DOUBLINGS)
+        {
+            printf("acb_calc_gl_nodes: failed to certify the nodes "
+                "(n = %ld, prec = %ld)\n", n, prec);
+            abort();
+        }
+
+        success = 1;
+
+        /* the positive roots in decreasing order */
+        for (i = 0; i < m && success; i++)
+        {
+            success = legendre_root(xs + i,
+                cos(3.14159265358979323846 * (4 * i + 3) / (4 * n + 2)), n, wp);
+
+            /* disjoint enclosures of n roots of P_n enclose all of them */
+            if (success && i > 0)
+            {
+                arb_sub(t, xs + i - 1, xs + i, wp);
+                success = arb_is_positive(t);
+            }
+        }
+
+        if (success && m > 0)
+            success = arb_is_positive(xs + m - 1);
+
+        if (success)
+            break;
+
+        wp *= 2;
+    }
+
+    if (n % 2 == 1)
+        arb_zero(xs + m);
+
+    /* w = 2 / ((1 - x^2) P'_n(x)^2) */
+    for (i = 0; i < n - m; i++)
+    {
+        legendre_eval(p, dp, xs + i, n, wp);
+        arb_mul(t, xs + i, xs + i, wp);
+        arb_sub_ui(t, t, 1, wp);
+        arb_neg(t, t);
+        arb_mul(dp, dp, dp, wp);
+        arb_mul(t, t, dp, wp);
+        arb_ui_div(ws + i, 2, t, prec);
+        arb_set_round(xs + i, xs + i, prec);
+
+        if (i < m)
+        {
+            arb_set(ws + n - 1 - i, ws + i);
+            arb_neg(xs + n - 1 - i, xs + i);
+        }
+    }
+
+    arb_clear(p);
+    arb_clear(dp);
+    arb_clear(t);
+}
@@ -0,0 +1,361 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "acb_calc.h"
+
+/* upper bound for log2(x) where x > 0 is finite, computed from the
+   exponent and the mantissa separately so that it cannot overflow */
+static double
+gl_log2_upper(const arf_t x)
+{
+    arf_t t;
+    long e;
+    double v;
+
+    e = arf_abs_bound_lt_2exp_si(x);
+
+    if (e >= ARF_PREC_EXACT || e <= -ARF_PREC_EXACT)
+        return (double) e;
+
+    arf_init(t);
+    arf_mul_2exp_si(t, x, -e);
+    v = mag_d_log_upper_bound(arf_get_d(t, ARF_RND_UP));
+    v = e + v * 1.4426950408889634074 * (1 - 1e-12);
+    arf_clear(t);
+
+    return v;
+}
+
+/* quadrature degrees are restricted to 1, 2, 3, 4, 6, 8, 12, 16, ...
+   so that nodes can be reused between subintervals; n is returned
+   unchanged if it exceeds all such degrees below GL_MAX_DEGREE */
+#define GL_MAX_DEGREE (LONG_MAX / 4)
+
+static long
+gl_round_degree(long n)
+{
+    long d;
+
+    if (n <= 4)
+        return FLINT_MAX(n, 1);
+
+    for (d = 4; ; d *= 2)
+    {
+        if (n <= d + d / 2)
+            return d + d / 2;
+        if (n <= 2 * d)
+            return 2 * d;
+        if (d > GL_MAX_DEGREE)
+            return n;
+    }
+}
+
+typedef struct
+{
+    long deg;
+    arb_ptr xs;
+    arb_ptr ws;
+}
+gl_nodes_struct;
+
+#define GL_CACHE_SIZE (2 * FLINT_BITS + 1)
+
+/* integrates over [m-h, m+h] using the degree n Gauss-Legendre rule,
+   reusing nodes already computed during this integration */
+static void
+gl_quadrature(acb_t s, acb_calc_func_t func, void * param,
+    const acb_t m, const acb_t h, long n,
+    gl_nodes_struct * cache, long * cache_len, long prec)
+{
+    acb_t t, v;
+    arb_srcptr xs, ws;
+    long i;
+
+    for (i = 0; i < *cache_len; i++)
+        if (cache[i].deg == n)
+            break;
+
+    if (i == *cache_len)
+    {
+        cache[i].deg = n;
+        cache[i].xs = _arb_vec_init(n);
+        cache[i].ws = _arb_vec_init(n);
+        acb_calc_gl_nodes_cached(cache[i].xs, cache[i].ws, n, prec);
+        (*cache_len)++;
+    }
+
+    xs = cache[i].xs;
+    ws = cache[i].ws;
+
+    acb_init(t);
+    acb_init(v);
+
+    acb_zero(s);
+
+    for (i = 0; i < n; i++)
+    {
+        acb_mul_arb(t, h, xs + i, prec);
+        acb_add(t, m, t, prec);
+        func(v, t, param, 1, prec);
+        acb_mul_arb(v, v, ws + i, prec);
+        acb_add(s, s, v, prec);
+    }
+
+    acb_mul(s, s, h, prec);
+
+    acb_clear(t);
+    acb_clear(v);
+}
+
+int
+acb_calc_integrate_gl(acb_t res,
+    acb_calc_func_t func, void * param,
+    const acb_t a, const acb_t b,
+    const arf_t outer_radius,
+    long accuracy_goal, long deg_limit, long maxdepth, long prec)
+{
+    acb_ptr as, bs;
+    long * depths;
+    long alloc, len, depth, n, bp, cache_len, i;
+    gl_nodes_struct cache[GL_CACHE_SIZE];
+    int result, converged;
+
+    acb_t m, h, s, sum;
+    arb_t cbound, rbound;
+    arf_t C, D, X, T, U;
+    mag_t err, TT;
+
+    if (deg_limit <= 0)
+        deg_limit = accuracy_goal + 16;
+
+    deg_limit = FLINT_MIN(deg_limit, GL_MAX_DEGREE);
+
+    /* largest admissible degree not exceeding deg_limit */
+    n = 1;
+    while (gl_round_degree(n + 1) <= deg_limit)
+        n = gl_round_degree(n + 1);
+    deg_limit = n;
+
+    /* precision used for bounds calculations */
+    bp = MAG_BITS;
+
+    acb_init(m);
+    acb_init(h);
+    acb_init(s);
+    acb_init(sum);
+    arb_init(cbound);
+    arb_init(rbound);
+    arf_init(C);
+    arf_init(D);
+    arf_init(X);
+    arf_init(T);
+    arf_init(U);
+    mag_init(err);
+    mag_init(TT);
+
+    alloc = 4;
+    as = _acb_vec_init(alloc);
+    bs = _acb_vec_init(alloc);
+    depths = flint_malloc(sizeof(long) * alloc);
+
+    acb_set(as, a);
+    acb_set(bs, b);
+    depths[0] = 0;
+    len = 1;
+
+    cache_len = 0;
+    arb_set_arf(rbound, outer_radius);
+
+    result = ARB_CALC_SUCCESS;
+    acb_zero(sum);
+
+    while (len > 0)
+    {
+        len--;
+        depth = depths[len];
+
+        /* m = (a+b)/2, h = (b-a)/2 */
+        acb_add(m, as + len, bs + len, prec);
+        acb_mul_2exp_si(m, m, -1);
+        acb_sub(h, bs + len, as + len, prec);
+        acb_mul_2exp_si(h, h, -1);
+
+        acb_get_abs_ubound_arf(X, h, bp);
+
+        converged = 0;
+        n = 0;
+
+        /* Error bound: the quadrature rule is exact for polynomials
+           of degree < 2n, and integrating x^k over [-1,1] with either
+           the exact integral or the rule gives at most 2 in absolute
+           value. Bounding the Taylor coefficients of f at m by
+           C(m,R) / R^k, we get the error bound
+           4 C(m,R) X T^(2n) / (1 - T) where T = X / R < 1. */
+        if (arf_cmp(X, outer_radius) < 0)
+        {
+            acb_calc_cauchy_bound(cbound, func, param, m, rbound, 8, bp);
+            arf_set_mag(C, arb_radref(cbound));
+            arf_add(C, arb_midref(cbound), C, bp, ARF_RND_UP);
+
+            arf_div(T, X, outer_radius, bp, ARF_RND_UP);
+            arf_one(U);
+            arf_sub(U, U, T, bp, ARF_RND_DOWN);
+
+            if (arf_is_finite(C) && arf_sgn(U) > 0)
+            {
+                arf_mul(D, C, X, bp, ARF_RND_UP);
+                arf_mul_2exp_si(D, D, 2);
+                arf_div(D, D, U, bp, ARF_RND_UP);
+
+                /* choose n such that D T^(2n) < 2^-(goal + depth); the
+                   error bound is computed rigorously below, so the
+                   logarithms only need to be accurate enough to give
+                   a good degree */
+                if (arf_is_zero(D) || arf_is_zero(T))
+                {
+                    n = 1;
+                }
+                else
+                {
+                    double NN, LT;
+
+                    LT = gl_log2_upper(T);
+
+                    if (LT >= 0.0)
+                    {
+                        n = deg_limit + 1;
+                    }
+                    else
+                    {
+                        NN = (gl_log2_upper(D) + accuracy_goal + depth)
+                            / (-2.0 * LT);
+                        NN = FLINT_MAX(NN, 1.0);
+                        n = (NN < deg_limit) ? (long) NN + 1 : deg_limit + 1;
+                    }
+                }
+
+                if (n <= deg_limit || depth >= maxdepth)
+                {
+                    if (n <= deg_limit)
+                    {
+                        n = FLINT_MIN(gl_round_degree(n), deg_limit);
+                    }
+                    else
+                    {
+                        n = deg_limit;
+                        result = ARB_CALC_NO_CONVERGENCE;
+                    }
+
+                    arf_get_mag(TT, T);
+                    mag_pow_ui(TT, TT, 2 * n);
+                    arf_get_mag(err, D);
+                    mag_mul(err, err, TT);
+                    converged = 1;
+                }
+            }
+        }
+
+        if (converged)
+        {
+            if (arb_calc_verbose)
+            {
+                printf("depth %ld, n = %ld; bound: ", depth, n);
+                mag_printd(err, 15); printf("\n");
+                printf("m: "); acb_printd(m, 15); printf("\n");
+            }
+
+            gl_quadrature(s, func, param, m, h, n, cache, &cache_len, prec);
+            acb_add_error_mag(s, err);
+            acb_add(sum, sum, s, prec);
+        }
+        else if (depth < maxdepth)
+        {
+            /* bisect */
+            if (len + 2 > alloc)
+            {
+                as = flint_realloc(as, sizeof(acb_struct) * 2 * alloc);
+                bs = flint_realloc(bs, sizeof(acb_struct) * 2 * alloc);
+                depths = flint_realloc(depths, sizeof(long) * 2 * alloc);
+                for (i = alloc; i < 2 * alloc; i++)
+                {
+                    acb_init(as + i);
+                    acb_init(bs + i);
+                }
+                alloc *= 2;
+            }
+
+            acb_set(as + len + 1, as + len);
+            acb_set(bs + len + 1, m);
+            acb_set(as + len, m);
+            depths[len] = depths[len + 1] = depth + 1;
+            len += 2;
+        }
+        else
+        {
+            /* the integral is contained in (b-a) f([a,b]) */
+            if (arb_calc_verbose)
+            {
+                printf("depth %ld, no convergence: ", depth);
+                acb_printd(m, 15); printf("\n");
+            }
+
+            acb_add_error_arf(m, X);
+            func(s, m, param, 1, prec);
+            acb_mul(s, s, h, prec);
+            acb_mul_2exp_si(s, s, 1);
+            acb_add(sum, sum, s, prec);
+            result = ARB_CALC_NO_CONVERGENCE;
+        }
+    }
+
+    acb_set(res, sum);
+
+    for (i = 0; i < cache_len; i++)
+    {
+        _arb_vec_clear(cache[i].xs, cache[i].deg);
+        _arb_vec_clear(cache[i].ws, cache[i].deg);
+    }
+
+    _acb_vec_clear(as, alloc);
+    _acb_vec_clear(bs, alloc);
+    flint_free(depths);
+
+    acb_clear(m);
+    acb_clear(h);
+    acb_clear(s);
+    acb_clear(sum);
+    arb_clear(cbound);
+    arb_clear(rbound);
+    arf_clear(C);
+    arf_clear(D);
+    arf_clear(X);
+    arf_clear(T);
+    arf_clear(U);
+    mag_clear(err);
+    mag_clear(TT);
+
+    return result;
+}
@@ -75,6 +75,8 @@ int main()
         prec = 2 + n_randint(state, 100);
         maxdepth = n_randint(state, 10);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+
         acb_calc_cauchy_bound(b, sin_x, NULL, x, radius, maxdepth, prec);
 
         arf_set_d(arb_midref(ans), answers[r-1]);
@@ -83,7 +85,8 @@ int main()
         if (!arb_overlaps(b, ans))
         {
             printf("FAIL\n");
-            printf("r = %ld, prec = %ld, maxdepth = %ld\n\n", r, prec, maxdepth);
+            printf("r = %ld, prec = %ld, maxdepth = %ld, threads = %d\n\n",
+                r, prec, maxdepth, flint_get_num_threads());
             arb_printd(b, 15); printf("\n\n");
             arb_printd(ans, 15); printf("\n\n");
             abort();
@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_calc.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+    const char * filename = "t-gl_cache.tmp";
+
+    printf("gl_cache....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        arb_ptr xs, ws, xs2, ws2;
+        long i, n, prec;
+
+        if (iter % 100 == 0)
+            acb_calc_gl_cache_set_size(n_randint(state, 10));
+
+        n = 1 + n_randint(state, 20);
+        prec = 2 + n_randint(state, 200);
+
+        xs = _arb_vec_init(n);
+        ws = _arb_vec_init(n);
+        xs2 = _arb_vec_init(n);
+        ws2 = _arb_vec_init(n);
+
+        acb_calc_gl_nodes_cached(xs, ws, n, prec);
+        acb_calc_gl_nodes(xs2, ws2, n, prec);
+
+        /* exercise saving and loading */
+        if (iter % 100 == 99)
+        {
+            if (!acb_calc_gl_cache_save(filename))
+            {
+                printf("FAIL: save\n\n");
+                abort();
+            }
+
+            acb_calc_gl_cache_clear();
+
+            if (!acb_calc_gl_cache_load(filename))
+            {
+                printf("FAIL: load\n\n");
+                abort();
+            }
+
+            remove(filename);
+
+            acb_calc_gl_nodes_cached(xs, ws, n, prec);
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            if (!arb_overlaps(xs + i, xs2 + i) || !arb_overlaps(ws + i, ws2 + i))
+            {
+                printf("FAIL: overlap\n\n");
+                printf("n = %ld, prec = %ld, i = %ld\n\n", n, prec, i);
+                printf("x = "); arb_printd(xs + i, 30); printf("\n\n");
+                printf("x2 = "); arb_printd(xs2 + i, 30); printf("\n\n");
+                printf("w = "); arb_printd(ws + i, 30); printf("\n\n");
+                printf("w2 = "); arb_printd(ws2 + i, 30); printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(xs, n);
+        _arb_vec_clear(ws, n);
+        _arb_vec_clear(xs2, n);
+        _arb_vec_clear(ws2, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_calc.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("gl_nodes....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500; iter++)
+    {
+        arb_ptr xs, ws, xs2, ws2;
+        arb_t s, t, u;
+        long i, k, n, prec, prec2;
+
+        n = 1 + n_randint(state, 40);
+        prec = 2 + n_randint(state, 300);
+        prec2 = 2 + n_randint(state, 300);
+
+        xs = _arb_vec_init(n);
+        ws = _arb_vec_init(n);
+        xs2 = _arb_vec_init(n);
+        ws2 = _arb_vec_init(n);
+        arb_init(s);
+        arb_init(t);
+        arb_init(u);
+
+        acb_calc_gl_nodes(xs, ws, n, prec);
+        acb_calc_gl_nodes(xs2, ws2, n, prec2);
+
+        for (i = 0; i < n; i++)
+        {
+            if (!arb_overlaps(xs + i, xs2 + i) || !arb_overlaps(ws + i, ws2 + i))
+            {
+                printf("FAIL: overlap\n\n");
+                printf("n = %ld, prec = %ld, prec2 = %ld, i = %ld\n\n",
+                    n, prec, prec2, i);
+                printf("x = "); arb_printd(xs + i, 30); printf("\n\n");
+                printf("x2 = "); arb_printd(xs2 + i, 30); printf("\n\n");
+                printf("w = "); arb_printd(ws + i, 30); printf("\n\n");
+                printf("w2 = "); arb_printd(ws2 + i, 30); printf("\n\n");
+                abort();
+            }
+        }
+
+        /* the rule integrates x^k exactly for k < 2n */
+        k = n_randint(state, 2 * n);
+        arb_zero(s);
+        for (i = 0; i < n; i++)
+        {
+            arb_pow_ui(t, xs + i, k, prec);
+            arb_addmul(s, t, ws + i, prec);
+        }
+
+        if (k % 2 == 0)
+        {
+            arb_set_ui(u, 2);
+            arb_div_ui(u, u, k + 1, prec);
+        }
+        else
+        {
+            arb_zero(u);
+        }
+
+        if (!arb_overlaps(s, u))
+        {
+            printf("FAIL: moments\n\n");
+            printf("n = %ld, prec = %ld, k = %ld\n\n", n, prec, k);
+            printf("s = "); arb_printd(s, 30); printf("\n\n");
+            printf("u = "); arb_printd(u, 30); printf("\n\n");
+            abort();
+        }
+
+        _arb_vec_clear(xs, n);
+        _arb_vec_clear(ws, n);
+        _arb_vec_clear(xs2, n);
+        _arb_vec_clear(ws2, n);
+        arb_clear(s);
+        arb_clear(t);
+        arb_clear(u);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -67,6 +67,23 @@ acb_mat_swap(acb_mat_t mat1, acb_mat_t mat2)
     *mat2 = t;
 }
 
+static __inline__ void
+acb_mat_swap_entrywise(acb_mat_t mat1, acb_mat_t mat2)
+{
+    long i, j;
+
+    for (i = 0; i < acb_mat_nrows(mat1); i++)
+        for (j = 0; j < acb_mat_ncols(mat1); j++)
+            acb_swap(acb_mat_entry(mat1, i, j), acb_mat_entry(mat2, i, j));
+}
+
+/* Window matrices */
+
+void acb_mat_window_init(acb_mat_t window, const acb_mat_t mat,
+    long r1, long c1, long r2, long c2);
+
+void acb_mat_window_clear(acb_mat_t window);
+
 /* Conversions */
 
 void acb_mat_set(acb_mat_t dest, const acb_mat_t src);
@@ -91,6 +108,8 @@ int acb_mat_contains_fmpq_mat(const acb_mat_t mat1, const fmpq_mat_t mat2);
 
 int acb_mat_contains_fmpz_mat(const acb_mat_t mat1, const fmpz_mat_t mat2);
 
+int acb_mat_is_symmetric(const acb_mat_t A);
+
 /* Special matrices */
 
 void acb_mat_zero(acb_mat_t mat);
@@ -111,6 +130,15 @@ void acb_mat_sub(acb_mat_t res, const acb_mat_t mat1, const acb_mat_t mat2, long
 
 void acb_mat_mul(acb_mat_t res, const acb_mat_t mat1, const acb_mat_t mat2, long prec);
 
+void _acb_mat_mul_vec(acb_ptr res, const acb_mat_t A, acb_srcptr v, long prec);
+
+void acb_mat_mul_vec(acb_ptr res, const acb_mat_t A, acb_srcptr v, long prec);
+
+void _acb_mat_mul_batch(acb_ptr C, acb_srcptr A, acb_srcptr B,
+    long m, long k, long n, long num, long prec);
+
+void acb_mat_sqr(acb_mat_t B, const acb_mat_t A, long prec);
+
 void acb_mat_pow_ui(acb_mat_t B, const acb_mat_t A, ulong exp, long prec);
 
 /* Scalar arithmetic */
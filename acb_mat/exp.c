@@ -28,6 +28,8 @@
 
 long _arb_mat_exp_choose_N(const mag_t norm, long prec);
 
+long _arb_mat_exp_choose_r(long * wp, const mag_t norm, double sqr_cost);
+
 /* evaluates the truncated Taylor series (assumes no aliasing) */
 void
 _acb_mat_exp_taylor(acb_mat_t S, const acb_mat_t A, long N, long prec)
@@ -45,7 +47,7 @@ _acb_mat_exp_taylor(acb_mat_t S, const acb_mat_t A, long N, long prec)
     {
         acb_mat_t T;
         acb_mat_init(T, acb_mat_nrows(A), acb_mat_nrows(A));
-        acb_mat_mul(T, A, A, prec);
+        acb_mat_sqr(T, A, prec);
         acb_mat_scalar_mul_2exp_si(T, T, -1);
         acb_mat_add(S, A, T, prec);
         acb_mat_one(T);
@@ -76,6 +78,8 @@ _acb_mat_exp_taylor(acb_mat_t S, const acb_mat_t A, long N, long prec)
                 acb_mat_one(pows + i);
             else if (i == 1)
                 acb_mat_set(pows + i, A);
+            else if (i == 2)
+                acb_mat_sqr(pows + i, A, prec);
             else
                 acb_mat_mul(pows + i, pows + i - 1, A, prec);
         }
@@ -120,7 +124,8 @@ _acb_mat_exp_taylor(acb_mat_t S, const acb_mat_t A, long N, long prec)
 void
 acb_mat_exp(acb_mat_t B, const acb_mat_t A, long prec)
 {
-    long i, j, dim, wp, N, q, r;
+    long i, j, dim, wp, N, r;
+    int sym;
     mag_t norm, err;
     acb_mat_t T;
 
@@ -156,14 +161,9 @@ acb_mat_exp(acb_mat_t B, const acb_mat_t A, long prec)
     }
     else
     {
-        q = pow(wp, 0.25);  /* wanted magnitude */
-
-        if (mag_cmp_2exp_si(norm, 2 * wp) > 0) /* too big */
-            r = 2 * wp;
-        else if (mag_cmp_2exp_si(norm, -q) < 0) /* tiny, no need to reduce */
-            r = 0;
-        else
-            r = FLINT_MAX(0, q + MAG_EXP(norm)); /* reduce to magnitude 2^(-r) */
+        /* squaring is cheaper if A, and hence exp(A/2^r), is symmetric */
+        sym = acb_mat_is_symmetric(A);
+        r = _arb_mat_exp_choose_r(&wp, norm, sym ? 0.5 : 1.0);
 
         acb_mat_scalar_mul_2exp_si(T, A, -r);
         mag_mul_2exp_si(norm, norm, -r);
@@ -173,14 +173,20 @@ acb_mat_exp(acb_mat_t B, const acb_mat_t A, long prec)
 
         _acb_mat_exp_taylor(B, T, N, wp);
 
+        /* restore exact symmetry (see acb_mat_pow_ui) */
+        if (sym)
+            for (i = 0; i < dim; i++)
+                for (j = i + 1; j < dim; j++)
+                    acb_set(acb_mat_entry(B, j, i), acb_mat_entry(B, i, j));
+
         for (i = 0; i < dim; i++)
             for (j = 0; j < dim; j++)
                 acb_add_error_mag(acb_mat_entry(B, i, j), err);
 
         for (i = 0; i < r; i++)
         {
-            acb_mat_mul(T, B, B, wp);
-            acb_mat_swap(T, B);
+            acb_mat_sqr(T, B, wp);
+            acb_mat_swap_entrywise(T, B);
         }
 
         for (i = 0; i < dim; i++)
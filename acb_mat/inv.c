@@ -34,7 +34,7 @@ acb_mat_inv(acb_mat_t X, const acb_mat_t A, long prec)
         acb_mat_t T;
         acb_mat_init(T, acb_mat_nrows(A), acb_mat_ncols(A));
         r = acb_mat_inv(T, A, prec);
-        acb_mat_swap(T, X);
+        acb_mat_swap_entrywise(T, X);
         acb_mat_clear(T);
         return r;
     }
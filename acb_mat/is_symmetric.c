@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_mat.h"
+
+int
+acb_mat_is_symmetric(const acb_mat_t A)
+{
+    long i, j, n;
+
+    n = acb_mat_nrows(A);
+
+    if (acb_mat_ncols(A) != n)
+        return 0;
+
+    for (i = 0; i < n; i++)
+        for (j = i + 1; j < n; j++)
+            if (!acb_equal(acb_mat_entry(A, i, j), acb_mat_entry(A, j, i)))
+                return 0;
+
+    return 1;
+}
@@ -52,7 +52,7 @@ acb_mat_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, long prec)
         acb_mat_t T;
         acb_mat_init(T, ar, bc);
         acb_mat_mul(T, A, B, prec);
-        acb_mat_swap(T, C);
+        acb_mat_swap_entrywise(T, C);
         acb_mat_clear(T);
         return;
     }
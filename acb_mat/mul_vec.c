@@ -0,0 +1,67 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_mat.h"
+
+void
+_acb_mat_mul_vec(acb_ptr res, const acb_mat_t A, acb_srcptr v, long prec)
+{
+    long i, j, r, c;
+
+    r = acb_mat_nrows(A);
+    c = acb_mat_ncols(A);
+
+    if (c == 0)
+    {
+        _acb_vec_zero(res, r);
+        return;
+    }
+
+    for (i = 0; i < r; i++)
+    {
+        acb_mul(res + i, acb_mat_entry(A, i, 0), v, prec);
+
+        for (j = 1; j < c; j++)
+            acb_addmul(res + i, acb_mat_entry(A, i, j), v + j, prec);
+    }
+}
+
+void
+acb_mat_mul_vec(acb_ptr res, const acb_mat_t A, acb_srcptr v, long prec)
+{
+    long r = acb_mat_nrows(A);
+
+    if (res == v)
+    {
+        acb_ptr t = _acb_vec_init(r);
+        _acb_mat_mul_vec(t, A, v, prec);
+        _acb_vec_set(res, t, r);
+        _acb_vec_clear(t, r);
+    }
+    else
+    {
+        _acb_mat_mul_vec(res, A, v, prec);
+    }
+}
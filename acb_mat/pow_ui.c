@@ -47,29 +47,49 @@ acb_mat_pow_ui(acb_mat_t B, const acb_mat_t A, ulong exp, long prec)
         }
         else if (exp == 2)
         {
-            acb_mat_mul(B, A, A, prec);   /* todo: sqr */
+            acb_mat_sqr(B, A, prec);
         }
     }
     else
     {
         acb_mat_t T, U;
-        long i;
+        long i, j, k;
+        int sym;
 
         acb_mat_init(T, d, d);
         acb_mat_set(T, A);
         acb_mat_init(U, d, d);
 
+        /*
+        If A is symmetric, so is every power. The product U A is not
+        computed symmetrically, so we restore symmetry by copying the upper
+        triangle; this is valid since A contains the transpose of every
+        point matrix it contains. Keeping T symmetric lets acb_mat_sqr
+        halve the work.
+        */
+        sym = acb_mat_is_symmetric(A);
+
         for (i = ((long) FLINT_BIT_COUNT(exp)) - 2; i >= 0; i--)
         {
-            acb_mat_mul(U, T, T, prec);   /* todo: sqr */
+            acb_mat_sqr(U, T, prec);
 
             if (exp & (1L << i))
+            {
                 acb_mat_mul(T, U, A, prec);
+
+                if (sym)
+                    for (j = 0; j < d; j++)
+                        for (k = j + 1; k < d; k++)
+                            acb_set(acb_mat_entry(T, k, j),
+                                acb_mat_entry(T, j, k));
+            }
             else
+            {
                 acb_mat_swap(T, U);
+            }
         }
 
-        acb_mat_swap(B, T);
+        acb_mat_swap_entrywise(B, T);
         acb_mat_clear(T);
         acb_mat_clear(U);
     }
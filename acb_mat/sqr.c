@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_mat.h"
+
+void
+acb_mat_sqr(acb_mat_t B, const acb_mat_t A, long prec)
+{
+    long n, i, j, k;
+
+    n = acb_mat_nrows(A);
+
+    if (acb_mat_ncols(A) != n || acb_mat_nrows(B) != n ||
+        acb_mat_ncols(B) != n)
+    {
+        printf("acb_mat_sqr: incompatible dimensions\n");
+        abort();
+    }
+
+    if (n == 0)
+        return;
+
+    if (n == 1)
+    {
+        acb_mul(acb_mat_entry(B, 0, 0),
+            acb_mat_entry(A, 0, 0), acb_mat_entry(A, 0, 0), prec);
+        return;
+    }
+
+    if (!acb_mat_is_symmetric(A))
+    {
+        acb_mat_mul(B, A, A, prec);
+        return;
+    }
+
+    if (A == B)
+    {
+        acb_mat_t T;
+        acb_mat_init(T, n, n);
+        acb_mat_sqr(T, A, prec);
+        acb_mat_swap_entrywise(T, B);
+        acb_mat_clear(T);
+        return;
+    }
+
+    /* only the upper triangle is needed (see arb_mat_sqr) */
+    for (i = 0; i < n; i++)
+    {
+        for (j = i; j < n; j++)
+        {
+            acb_mul(acb_mat_entry(B, i, j),
+                      acb_mat_entry(A, i, 0),
+                      acb_mat_entry(A, j, 0), prec);
+
+            for (k = 1; k < n; k++)
+            {
+                acb_addmul(acb_mat_entry(B, i, j),
+                             acb_mat_entry(A, i, k),
+                             acb_mat_entry(A, j, k), prec);
+            }
+
+            if (j != i)
+                acb_set(acb_mat_entry(B, j, i), acb_mat_entry(B, i, j));
+        }
+    }
+}
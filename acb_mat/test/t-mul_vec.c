@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_mat.h"
+
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("mul_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        long m, n, i, qbits1, qbits2, rbits1, rbits2, rbits3;
+        fmpq_mat_t A, B;
+        acb_mat_t a, b, c;
+        acb_ptr v, w;
+
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 200);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 2) ? m : n_randint(state, 10);
+
+        fmpq_mat_init(A, m, n);
+        fmpq_mat_init(B, n, 1);
+
+        acb_mat_init(a, m, n);
+        acb_mat_init(b, n, 1);
+        acb_mat_init(c, m, 1);
+
+        v = _acb_vec_init(FLINT_MAX(m, n));
+        w = _acb_vec_init(m);
+
+        fmpq_mat_randtest(A, state, qbits1);
+        fmpq_mat_randtest(B, state, qbits2);
+
+        acb_mat_set_fmpq_mat(a, A, rbits1);
+        acb_mat_set_fmpq_mat(b, B, rbits2);
+        acb_mat_mul(c, a, b, rbits3);
+
+        for (i = 0; i < n; i++)
+            acb_set(v + i, acb_mat_entry(b, i, 0));
+
+        acb_mat_mul_vec(w, a, v, rbits3);
+
+        for (i = 0; i < m; i++)
+        {
+            if (!acb_equal(w + i, acb_mat_entry(c, i, 0)))
+            {
+                printf("FAIL\n\n");
+                printf("m = %ld, n = %ld, bits3 = %ld\n", m, n, rbits3);
+                printf("a = "); acb_mat_printd(a, 15); printf("\n\n");
+                printf("b = "); acb_mat_printd(b, 15); printf("\n\n");
+                printf("c = "); acb_mat_printd(c, 15); printf("\n\n");
+                abort();
+            }
+        }
+
+        /* test aliasing */
+        if (m == n)
+        {
+            acb_mat_mul_vec(v, a, v, rbits3);
+
+            for (i = 0; i < m; i++)
+            {
+                if (!acb_equal(v + i, w + i))
+                {
+                    printf("FAIL (aliasing)\n\n");
+                    abort();
+                }
+            }
+        }
+
+        fmpq_mat_clear(A);
+        fmpq_mat_clear(B);
+
+        acb_mat_clear(a);
+        acb_mat_clear(b);
+        acb_mat_clear(c);
+
+        _acb_vec_clear(v, FLINT_MAX(m, n));
+        _acb_vec_clear(w, m);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_mat.h"
+
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("sqr....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        long n, i, j, qbits, rbits1, rbits2;
+        fmpq_mat_t A, C;
+        acb_mat_t a, b, c;
+
+        qbits = 2 + n_randint(state, 200);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+
+        n = n_randint(state, 10);
+
+        fmpq_mat_init(A, n, n);
+        fmpq_mat_init(C, n, n);
+
+        acb_mat_init(a, n, n);
+        acb_mat_init(b, n, n);
+        acb_mat_init(c, n, n);
+
+        fmpq_mat_randtest(A, state, qbits);
+
+        /* exercise the symmetric code path */
+        if (n_randint(state, 2))
+            for (i = 0; i < n; i++)
+                for (j = i + 1; j < n; j++)
+                    fmpq_set(fmpq_mat_entry(A, j, i), fmpq_mat_entry(A, i, j));
+
+        fmpq_mat_mul(C, A, A);
+
+        acb_mat_set_fmpq_mat(a, A, rbits1);
+        acb_mat_sqr(b, a, rbits2);
+
+        if (!acb_mat_contains_fmpq_mat(b, C))
+        {
+            printf("FAIL\n\n");
+            printf("n = %ld, bits2 = %ld\n", n, rbits2);
+
+            printf("A = "); fmpq_mat_print(A); printf("\n\n");
+            printf("C = "); fmpq_mat_print(C); printf("\n\n");
+
+            printf("a = "); acb_mat_printd(a, 15); printf("\n\n");
+            printf("b = "); acb_mat_printd(b, 15); printf("\n\n");
+
+            abort();
+        }
+
+        acb_mat_mul(c, a, a, rbits2);
+
+        if (!acb_mat_overlaps(b, c))
+        {
+            printf("FAIL (overlap)\n\n");
+            printf("a = "); acb_mat_printd(a, 15); printf("\n\n");
+            printf("b = "); acb_mat_printd(b, 15); printf("\n\n");
+            printf("c = "); acb_mat_printd(c, 15); printf("\n\n");
+            abort();
+        }
+
+        /* test aliasing */
+        acb_mat_set(c, a);
+        acb_mat_sqr(c, c, rbits2);
+        if (!acb_mat_equal(c, b))
+        {
+            printf("FAIL (aliasing)\n\n");
+            abort();
+        }
+
+        fmpq_mat_clear(A);
+        fmpq_mat_clear(C);
+
+        acb_mat_clear(a);
+        acb_mat_clear(b);
+        acb_mat_clear(c);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_mat.h"
+
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("window_init....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        long r, c, r1, r2, c1, c2, s, i, j, prec;
+        fmpq_mat_t Q;
+        acb_mat_t A, A0, W, S, U;
+
+        r = n_randint(state, 10);
+        c = n_randint(state, 10);
+        prec = 2 + n_randint(state, 200);
+
+        r1 = n_randint(state, r + 1);
+        r2 = r1 + n_randint(state, r - r1 + 1);
+        c1 = n_randint(state, c + 1);
+        c2 = c1 + n_randint(state, c - c1 + 1);
+
+        fmpq_mat_init(Q, r, c);
+        acb_mat_init(A, r, c);
+        acb_mat_init(A0, r, c);
+
+        fmpq_mat_randtest(Q, state, 2 + n_randint(state, 100));
+        acb_mat_set_fmpq_mat(A, Q, prec);
+        acb_mat_set(A0, A);
+
+        acb_mat_window_init(W, A, r1, c1, r2, c2);
+
+        if (acb_mat_nrows(W) != r2 - r1 || acb_mat_ncols(W) != c2 - c1)
+        {
+            printf("FAIL (dimensions)\n\n");
+            abort();
+        }
+
+        for (i = 0; i < r2 - r1; i++)
+        {
+            for (j = 0; j < c2 - c1; j++)
+            {
+                if (acb_mat_entry(W, i, j) != acb_mat_entry(A, r1 + i, c1 + j))
+                {
+                    printf("FAIL (entries)\n\n");
+                    abort();
+                }
+            }
+        }
+
+        acb_mat_window_clear(W);
+
+        /* square a square window in place */
+        s = FLINT_MIN(r2 - r1, c2 - c1);
+        acb_mat_window_init(W, A, r1, c1, r1 + s, c1 + s);
+        acb_mat_init(S, s, s);
+        acb_mat_init(U, s, s);
+
+        acb_mat_set(S, W);
+        acb_mat_mul(U, S, S, prec);
+        acb_mat_mul(W, W, W, prec);
+
+        for (i = 0; i < r; i++)
+        {
+            for (j = 0; j < c; j++)
+            {
+                int inside = (i >= r1 && i < r1 + s && j >= c1 && j < c1 + s);
+
+                if ((inside && !acb_equal(acb_mat_entry(A, i, j),
+                        acb_mat_entry(U, i - r1, j - c1))) ||
+                    (!inside && !acb_equal(acb_mat_entry(A, i, j),
+                        acb_mat_entry(A0, i, j))))
+                {
+                    printf("FAIL (aliasing, iter = %ld)\n\n", iter);
+                    printf("A0 = "); acb_mat_printd(A0, 15); printf("\n\n");
+                    printf("A = "); acb_mat_printd(A, 15); printf("\n\n");
+                    printf("U = "); acb_mat_printd(U, 15); printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        acb_mat_window_clear(W);
+
+        fmpq_mat_clear(Q);
+        acb_mat_clear(A);
+        acb_mat_clear(A0);
+        acb_mat_clear(S);
+        acb_mat_clear(U);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,43 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_mat.h"
+
+void
+acb_mat_window_init(acb_mat_t window, const acb_mat_t mat,
+    long r1, long c1, long r2, long c2)
+{
+    long i;
+
+    window->entries = NULL;
+    window->r = r2 - r1;
+    window->c = c2 - c1;
+    window->rows = flint_malloc(sizeof(acb_ptr) * FLINT_MAX(r2 - r1, 1));
+
+    /* a matrix with zero columns has no valid row pointers */
+    if (c2 > c1)
+        for (i = 0; i < r2 - r1; i++)
+            window->rows[i] = mat->rows[r1 + i] + c1;
+}
@@ -283,6 +283,14 @@ void _acb_poly_rem(acb_ptr R,
     acb_srcptr A, long lenA,
     acb_srcptr B, long lenB, long prec);
 
+void _acb_poly_divrem_preinv(acb_ptr Q, acb_ptr R,
+    acb_srcptr A, long lenA, acb_srcptr B, long lenB,
+    acb_srcptr Binv, long lenBinv, long prec);
+
+void _acb_poly_rem_preinv(acb_ptr R,
+    acb_srcptr A, long lenA, acb_srcptr B, long lenB,
+    acb_srcptr Binv, long lenBinv, long prec);
+
 void acb_poly_divrem(acb_poly_t Q, acb_poly_t R,
                              const acb_poly_t A, const acb_poly_t B, long prec);
 
@@ -353,6 +361,10 @@ void
 _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     long plen, acb_ptr * tree, long len, long prec);
 
+void
+_acb_poly_evaluate_vec_fast_precomp_preinv(acb_ptr vs, acb_srcptr poly,
+    long plen, acb_ptr * tree, acb_ptr * tree_inv, long len, long prec);
+
 void _acb_poly_evaluate_vec_fast(acb_ptr ys, acb_srcptr poly, long plen,
     acb_srcptr xs, long n, long prec);
 
@@ -393,6 +405,33 @@ void
 acb_poly_interpolate_fast(acb_poly_t poly,
         acb_srcptr xs, acb_srcptr ys, long n, long prec);
 
+typedef struct
+{
+    acb_ptr * tree;
+    acb_ptr * tree_inv;
+    acb_ptr weights;
+    long len;
+    long prec;
+}
+acb_poly_multipoint_struct;
+
+typedef acb_poly_multipoint_struct acb_poly_multipoint_t[1];
+
+void
+acb_poly_multipoint_init(acb_poly_multipoint_t M,
+    acb_srcptr xs, long n, long prec);
+
+void
+acb_poly_multipoint_clear(acb_poly_multipoint_t M);
+
+void
+acb_poly_multipoint_evaluate(acb_ptr ys, const acb_poly_multipoint_t M,
+    const acb_poly_t poly, long prec);
+
+void
+acb_poly_multipoint_interpolate(acb_poly_t poly,
+    const acb_poly_multipoint_t M, acb_srcptr ys, long prec);
+
 void
 _acb_poly_interpolate_newton(acb_ptr poly, acb_srcptr xs,
     acb_srcptr ys, long n, long prec);
@@ -407,6 +446,10 @@ _acb_poly_product_roots(acb_ptr poly, acb_srcptr xs, long n, long prec);
 void
 acb_poly_product_roots(acb_poly_t poly, acb_srcptr xs, long n, long prec);
 
+/* minimum value of (number of blocks) * (block length) * prec for
+   splitting one level of a product tree over several threads */
+#define ACB_POLY_TREE_THREAD_CUTOFF 50000
+
 acb_ptr * _acb_poly_tree_alloc(long len);
 
 void _acb_poly_tree_free(acb_ptr * tree, long len);
@@ -414,6 +457,14 @@ void _acb_poly_tree_free(acb_ptr * tree, long len);
 void
 _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, long len, long prec);
 
+acb_ptr * _acb_poly_tree_inv_alloc(long len);
+
+void _acb_poly_tree_inv_free(acb_ptr * tree_inv, long len);
+
+void
+_acb_poly_tree_inv_build(acb_ptr * tree_inv, acb_ptr * tree,
+    long len, long prec);
+
 
 void _acb_poly_root_inclusion(acb_t r, const acb_t m,
     acb_srcptr poly,
@@ -545,8 +596,10 @@ void _acb_poly_mullow_cpx(acb_ptr res, acb_srcptr src, long len, const acb_t c,
 void _acb_poly_powsum_series_naive(acb_ptr z, const acb_t s, const acb_t a, const acb_t q, long n, long len, long prec);
 void _acb_poly_powsum_series_naive_threaded(acb_ptr z, const acb_t s, const acb_t a, const acb_t q, long n, long len, long prec);
 void _acb_poly_powsum_one_series_sieved(acb_ptr z, const acb_t s, long n, long len, long prec);
+void _acb_poly_powsum_fmpq_series(acb_ptr z, const acb_t s, const fmpq_t a, long n, long len, long prec);
 
 void _acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, long d, long prec);
+void _acb_poly_zeta_em_sum_fmpq(acb_ptr z, const acb_t s, const fmpq_t a, int deflate, ulong N, ulong M, long d, long prec);
 void _acb_poly_zeta_em_choose_param(arf_t bound, ulong * N, ulong * M, const acb_t s, const acb_t a, long d, long target, long prec);
 void _acb_poly_zeta_em_bound1(arf_t bound, const acb_t s, const acb_t a, long N, long M, long d, long wp);
 void _acb_poly_zeta_em_bound(arb_ptr vec, const acb_t s, const acb_t a, ulong N, ulong M, long d, long wp);
@@ -556,6 +609,8 @@ void _acb_poly_zeta_em_tail_bsplit(acb_ptr z, const acb_t s, const acb_t Na, acb
 
 void _acb_poly_zeta_cpx_series(acb_ptr z, const acb_t s, const acb_t a, int deflate, long d, long prec);
 
+void _acb_poly_zeta_cpx_series_fmpq(acb_ptr z, const acb_t s, const fmpq_t a, int deflate, long d, long prec);
+
 void _acb_poly_zeta_series(acb_ptr res, acb_srcptr h, long hlen, const acb_t a, int deflate, long len, long prec);
 
 void acb_poly_zeta_series(acb_poly_t res, const acb_poly_t f, const acb_t a, int deflate, long n, long prec);
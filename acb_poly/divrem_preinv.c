@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_divrem_preinv(acb_ptr Q, acb_ptr R,
+    acb_srcptr A, long lenA, acb_srcptr B, long lenB,
+    acb_srcptr Binv, long lenBinv, long prec)
+{
+    const long lenQ = lenA - lenB + 1;
+    acb_ptr Arev;
+
+    if (lenQ > lenBinv)
+    {
+        printf("Exception: precomputed inverse too short in "
+            "_acb_poly_divrem_preinv\n");
+        abort();
+    }
+
+    Arev = _acb_vec_init(lenQ);
+    _acb_poly_reverse(Arev, A + (lenA - lenQ), lenQ, lenQ);
+    _acb_poly_mullow(Q, Binv, lenQ, Arev, lenQ, lenQ, prec);
+    _acb_poly_reverse(Q, Q, lenQ, lenQ);
+    _acb_vec_clear(Arev, lenQ);
+
+    if (lenB > 1)
+    {
+        if (lenQ >= lenB - 1)
+            _acb_poly_mullow(R, Q, lenQ, B, lenB - 1, lenB - 1, prec);
+        else
+            _acb_poly_mullow(R, B, lenB - 1, Q, lenQ, lenB - 1, prec);
+        _acb_vec_sub(R, A, R, lenB - 1, prec);
+    }
+}
+
+void
+_acb_poly_rem_preinv(acb_ptr R,
+    acb_srcptr A, long lenA, acb_srcptr B, long lenB,
+    acb_srcptr Binv, long lenBinv, long prec)
+{
+    const long lenQ = lenA - lenB + 1;
+    acb_ptr Q = _acb_vec_init(lenQ);
+    _acb_poly_divrem_preinv(Q, R, A, lenA, B, lenB, Binv, lenBinv, prec);
+    _acb_vec_clear(Q, lenQ);
+}
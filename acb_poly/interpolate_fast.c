@@ -23,6 +23,7 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "acb_poly.h"
 
 void
@@ -57,13 +58,104 @@ _acb_poly_interpolation_weights(acb_ptr w,
     _acb_vec_clear(tmp, len + 1);
 }
 
+/* combines blocks start, ..., stop - 1 of one level in place, using
+   scratch space t, u of length 2 pow */
+static void
+_acb_poly_interpolate_fast_blocks(acb_ptr pb, acb_srcptr pa, long pow,
+    long start, long stop, acb_ptr t, acb_ptr u, long prec)
+{
+    long j;
+    acb_srcptr a;
+    acb_ptr b;
+
+    for (j = start; j < stop; j++)
+    {
+        a = pa + (2 * pow + 2) * j;
+        b = pb + 2 * pow * j;
+
+        _acb_poly_mul(t, a, pow + 1, b + pow, pow, prec);
+        _acb_poly_mul(u, a + pow + 1, pow + 1, b, pow, prec);
+        _acb_vec_add(b, t, u, 2 * pow, prec);
+    }
+}
+
+typedef struct
+{
+    acb_ptr pb;
+    acb_srcptr pa;
+    long pow;
+    long start;
+    long stop;
+    long prec;
+}
+interpolate_fast_arg_t;
+
+static void *
+_acb_poly_interpolate_fast_worker(void * arg_ptr)
+{
+    interpolate_fast_arg_t arg = *((interpolate_fast_arg_t *) arg_ptr);
+    acb_ptr t, u;
+
+    t = _acb_vec_init(2 * arg.pow);
+    u = _acb_vec_init(2 * arg.pow);
+
+    _acb_poly_interpolate_fast_blocks(arg.pb, arg.pa, arg.pow,
+        arg.start, arg.stop, t, u, arg.prec);
+
+    _acb_vec_clear(t, 2 * arg.pow);
+    _acb_vec_clear(u, 2 * arg.pow);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* the blocks of a level are independent and can be split over threads */
+static void
+_acb_poly_interpolate_fast_level(acb_ptr pb, acb_srcptr pa, long pow,
+    long num, acb_ptr t, acb_ptr u, long prec)
+{
+    long i, num_threads;
+    pthread_t * threads;
+    interpolate_fast_arg_t * args;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    if (num_threads <= 1 ||
+        (double) num * pow * prec < ACB_POLY_TREE_THREAD_CUTOFF)
+    {
+        _acb_poly_interpolate_fast_blocks(pb, pa, pow, 0, num, t, u, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(interpolate_fast_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].pb = pb;
+        args[i].pa = pa;
+        args[i].pow = pow;
+        args[i].start = (num * i) / num_threads;
+        args[i].stop = (num * (i + 1)) / num_threads;
+        args[i].prec = prec;
+        pthread_create(&threads[i], NULL,
+            _acb_poly_interpolate_fast_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 _acb_poly_interpolate_fast_precomp(acb_ptr poly,
     acb_srcptr ys, acb_ptr * tree, acb_srcptr weights,
     long len, long prec)
 {
     acb_ptr t, u, pa, pb;
-    long i, pow, left;
+    long i, pow, left, num;
 
     if (len == 0)
         return;
@@ -77,20 +169,13 @@ _acb_poly_interpolate_fast_precomp(acb_ptr poly,
     for (i = 0; i < FLINT_CLOG2(len); i++)
     {
         pow = (1L << i);
-        pa = tree[i];
-        pb = poly;
-        left = len;
+        num = len / (2 * pow);
+        left = len - num * 2 * pow;
 
-        while (left >= 2 * pow)
-        {
-            _acb_poly_mul(t, pa, pow + 1, pb + pow, pow, prec);
-            _acb_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, prec);
-            _acb_vec_add(pb, t, u, 2 * pow, prec);
+        _acb_poly_interpolate_fast_level(poly, tree[i], pow, num, t, u, prec);
 
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-        }
+        pa = tree[i] + num * (2 * pow + 2);
+        pb = poly + num * 2 * pow;
 
         if (left > pow)
         {
@@ -0,0 +1,34 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+void
+acb_poly_multipoint_evaluate(acb_ptr ys, const acb_poly_multipoint_t M,
+    const acb_poly_t poly, long prec)
+{
+    _acb_poly_evaluate_vec_fast_precomp_preinv(ys, poly->coeffs,
+        poly->length, M->tree, M->tree_inv, M->len, prec);
+}
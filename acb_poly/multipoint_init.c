@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+void
+acb_poly_multipoint_init(acb_poly_multipoint_t M,
+    acb_srcptr xs, long n, long prec)
+{
+    M->len = n;
+    M->prec = prec;
+    M->tree = _acb_poly_tree_alloc(n);
+    M->tree_inv = _acb_poly_tree_inv_alloc(n);
+    M->weights = _acb_vec_init(n);
+
+    _acb_poly_tree_build(M->tree, xs, n, prec);
+    _acb_poly_tree_inv_build(M->tree_inv, M->tree, n, prec);
+    _acb_poly_interpolation_weights(M->weights, M->tree, n, prec);
+}
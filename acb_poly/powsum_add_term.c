@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012-2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "powsum_impl.h"
+
+void
+_acb_poly_powsum_add_term(acb_ptr u, const acb_t t, const arb_t logk,
+    acb_t v, long len, long prec)
+{
+    long i;
+
+    acb_add(u, u, t, prec);
+
+    if (len > 1)
+    {
+        acb_set(v, t);
+
+        for (i = 1; i < len; i++)
+        {
+            acb_mul_arb(v, v, logk, prec);
+
+            if (i % 2 == 1)
+                acb_sub(u + i, u + i, v, prec);
+            else
+                acb_add(u + i, u + i, v, prec);
+        }
+    }
+}
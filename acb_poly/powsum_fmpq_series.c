@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "acb_poly.h"
+
+void
+_acb_poly_powsum_fmpq_series(acb_ptr z, const acb_t s, const fmpq_t a,
+    long n, long len, long prec)
+{
+    ulong p, q, m, mprev;
+    long k, i;
+    acb_t t;
+    arb_t logm, logq, L, w;
+
+    if (fmpz_sgn(fmpq_numref(a)) <= 0 || !fmpz_abs_fits_ui(fmpq_numref(a))
+        || !fmpz_abs_fits_ui(fmpq_denref(a)) || n < 1 ||
+        fmpz_get_ui(fmpq_denref(a)) > (ULONG_MAX - fmpz_get_ui(fmpq_numref(a)))
+            / (ulong) n)
+    {
+        acb_t aa, one;
+        acb_init(aa);
+        acb_init(one);
+        acb_set_fmpq(aa, a, prec);
+        acb_one(one);
+        _acb_poly_powsum_series_naive(z, s, aa, one, n, len, prec);
+        acb_clear(aa);
+        acb_clear(one);
+        return;
+    }
+
+    p = fmpz_get_ui(fmpq_numref(a));
+    q = fmpz_get_ui(fmpq_denref(a));
+
+    acb_init(t);
+    arb_init(logm);
+    arb_init(logq);
+    arb_init(L);
+    arb_init(w);
+
+    _acb_vec_zero(z, len);
+    arb_log_ui(logq, q, prec);
+
+    /* (k + p/q)^(-(s+x)) = exp(-(s+x) (log(qk+p) - log(q))), where the
+       logarithms of the integers qk+p are computed from their predecessors */
+    mprev = 0;
+    for (k = 0; k < n; k++)
+    {
+        m = q * k + p;
+        arb_log_ui_from_prev(logm, m, logm, mprev, prec);
+        mprev = m;
+        arb_sub(L, logm, logq, prec);
+
+        arb_mul(w, L, acb_imagref(s), prec);
+        arb_neg(w, w);
+        arb_sin_cos(acb_imagref(t), acb_realref(t), w, prec);
+        arb_mul(w, L, acb_realref(s), prec);
+        arb_neg(w, w);
+        arb_exp(w, w, prec);
+        acb_mul_arb(t, t, w, prec);
+
+        /* z_i += t (-L)^i; the factorials are divided out below */
+        acb_add(z, z, t, prec);
+        for (i = 1; i < len; i++)
+        {
+            acb_mul_arb(t, t, L, prec);
+
+            if (i % 2 == 1)
+                acb_sub(z + i, z + i, t, prec);
+            else
+                acb_add(z + i, z + i, t, prec);
+        }
+    }
+
+    if (len > 2)
+    {
+        fmpz_t f;
+        fmpz_init(f);
+        fmpz_one(f);
+        for (i = 2; i < len; i++)
+        {
+            fmpz_mul_ui(f, f, i);
+            acb_div_fmpz(z + i, z + i, f, prec);
+        }
+        fmpz_clear(f);
+    }
+
+    acb_clear(t);
+    arb_clear(logm);
+    arb_clear(logq);
+    arb_clear(L);
+    arb_clear(w);
+}
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012-2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "powsum_impl.h"
+
+void
+_acb_poly_powsum_horner_step(acb_ptr z, acb_srcptr u, acb_srcptr x,
+    acb_ptr t, acb_ptr tmp, long len, long prec)
+{
+    long i;
+
+    _acb_vec_set(tmp, u, len);
+    if (len > 2)
+    {
+        fmpz_t f;
+        fmpz_init(f);
+        fmpz_one(f);
+        for (i = 2; i < len; i++)
+        {
+            fmpz_mul_ui(f, f, i);
+            acb_div_fmpz(tmp + i, tmp + i, f, prec);
+        }
+        fmpz_clear(f);
+    }
+
+    _acb_poly_mullow(t, z, len, x, len, len, prec);
+    _acb_vec_add(z, t, tmp, len, prec);
+}
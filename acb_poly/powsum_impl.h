@@ -0,0 +1,62 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012-2014 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef ACB_POLY_POWSUM_IMPL_H
+#define ACB_POLY_POWSUM_IMPL_H
+
+#include "acb_poly.h"
+
+/* helpers shared by the sieved power sums */
+
+/* tables indexed by odd k */
+#define POWER(_k) (powers + (((_k)-1)/2))
+#define LOG(_k) (logs + (((_k)-1)/2))
+#define DIVISOR(_k) (divisors[((_k)-1)/2])
+
+/* sets DIVISOR(k) to the smallest prime factor of each odd composite
+   k <= n, leaving it zero for odd primes; divisors must be zeroed
+   and have room for n / 2 + 1 entries */
+static __inline__ void
+_acb_poly_powsum_sieve(long * divisors, long n)
+{
+    long i, j, ibound;
+
+    ibound = n_sqrt(n);
+    for (i = 3; i <= ibound; i += 2)
+        if (DIVISOR(i) == 0)
+            for (j = i * i; j <= n; j += 2 * i)
+                DIVISOR(j) = i;
+}
+
+/* u_i += t (-log k)^i for 0 <= i < len; the factorials are divided out
+   when u is used */
+void _acb_poly_powsum_add_term(acb_ptr u, const acb_t t, const arb_t logk,
+    acb_t v, long len, long prec);
+
+/* z = z * x + u / i! */
+void _acb_poly_powsum_horner_step(acb_ptr z, acb_srcptr u, acb_srcptr x,
+    acb_ptr t, acb_ptr tmp, long len, long prec);
+
+#endif
@@ -23,32 +23,28 @@
 
 ******************************************************************************/
 
-#include "acb_poly.h"
 
-#define POWER(_k) (powers + (((_k)-1)/2) * (len))
-#define DIVISOR(_k) (divisors[((_k)-1)/2])
+#include "powsum_impl.h"
 
+/* t = k^(-s); also sets logk = log(k) if len != 1 or s is not an integer */
 #define COMPUTE_POWER(t, k, kprev) \
   do { \
+    if (len != 1 || !integer) \
+    { \
+        arb_log_ui_from_prev(logk, k, logk, kprev, prec); \
+        kprev = k; \
+    } \
     if (integer) \
     { \
         arb_neg(w, acb_realref(s)); \
         arb_set_ui(v, k); \
         arb_pow(acb_realref(t), v, w, prec); \
         arb_zero(acb_imagref(t)); \
-        if (len != 1) \
-        { \
-            arb_log_ui_from_prev(logk, k, logk, kprev, prec); \
-            kprev = k; \
-            arb_neg(logk, logk); \
-        } \
     } \
     else \
     { \
-        arb_log_ui_from_prev(logk, k, logk, kprev, prec); \
-        kprev = k; \
-        arb_neg(logk, logk); \
         arb_mul(w, logk, acb_imagref(s), prec); \
+        arb_neg(w, w); \
         arb_sin_cos(acb_imagref(t), acb_realref(t), w, prec); \
         if (critical_line) \
         { \
@@ -58,16 +54,11 @@
         else \
         { \
             arb_mul(w, acb_realref(s), logk, prec); \
+            arb_neg(w, w); \
             arb_exp(w, w, prec); \
             acb_mul_arb(t, t, w, prec); \
         } \
     } \
-    for (i = 1; i < len; i++) \
-    { \
-        acb_mul_arb(t + i, t + i - 1, logk, prec); \
-        acb_div_ui(t + i, t + i, i, prec); \
-    } \
-    arb_neg(logk, logk); \
   } while (0); \
 
 void
@@ -75,13 +66,15 @@ _acb_poly_powsum_one_series_sieved(acb_ptr z, const acb_t s, long n, long len, l
 {
     long * divisors;
     long powers_alloc;
-    long i, j, k, ibound, kprev, power_of_two, horner_point;
+    long i, k, kprev, power_of_two, horner_point;
     int critical_line, integer;
 
     acb_ptr powers;
-    acb_ptr t, u, x;
-    acb_ptr p1, p2;
-    arb_t logk, v, w;
+    arb_ptr logs;
+    acb_ptr t, u, x, tmp;
+    acb_t v2;
+    arb_t logk, logc, v, w;
+    arb_srcptr logt;
 
     critical_line = arb_is_exact(acb_realref(s)) &&
         (arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) == 0);
@@ -89,19 +82,24 @@ _acb_poly_powsum_one_series_sieved(acb_ptr z, const acb_t s, long n, long len, l
     integer = arb_is_zero(acb_imagref(s)) && arb_is_int(acb_realref(s));
 
     divisors = flint_calloc(n / 2 + 1, sizeof(long));
-    powers_alloc = (n / 6 + 1) * len;
+
+    /* k^(-s) and log(k) are stored for odd k <= n / 3, which covers
+       the factors of all odd composite k <= n; the remaining
+       coefficients of k^(-(s+x)) = k^(-s) exp(-x log(k)) are obtained
+       by scalar multiplications */
+    powers_alloc = n / 6 + 1;
     powers = _acb_vec_init(powers_alloc);
+    logs = (len != 1) ? _arb_vec_init(powers_alloc) : NULL;
 
-    ibound = n_sqrt(n);
-    for (i = 3; i <= ibound; i += 2)
-        if (DIVISOR(i) == 0)
-            for (j = i * i; j <= n; j += 2 * i)
-                DIVISOR(j) = i;
+    _acb_poly_powsum_sieve(divisors, n);
 
     t = _acb_vec_init(len);
     u = _acb_vec_init(len);
     x = _acb_vec_init(len);
+    tmp = _acb_vec_init(len);
+    acb_init(v2);
     arb_init(logk);
+    arb_init(logc);
     arb_init(v);
     arb_init(w);
 
@@ -112,36 +110,49 @@ _acb_poly_powsum_one_series_sieved(acb_ptr z, const acb_t s, long n, long len, l
 
     _acb_vec_zero(z, len);
 
+    /* x = 2^(-(s+x)) */
     kprev = 0;
     COMPUTE_POWER(x, 2, kprev);
+    if (len != 1)
+    {
+        arb_neg(w, logk);
+        for (i = 1; i < len; i++)
+        {
+            acb_mul_arb(x + i, x + i - 1, w, prec);
+            acb_div_ui(x + i, x + i, i, prec);
+        }
+    }
 
     for (k = 1; k <= n; k += 2)
     {
-        /* t = k^(-s) */
+        /* t = k^(-s), logt = log(k); logk is kept equal to the
+           logarithm of the last prime for arb_log_ui_from_prev */
         if (DIVISOR(k) == 0)
         {
             COMPUTE_POWER(t, k, kprev);
+            logt = logk;
         }
         else
         {
-            p1 = POWER(DIVISOR(k));
-            p2 = POWER(k / DIVISOR(k));
+            acb_mul(t, POWER(DIVISOR(k)), POWER(k / DIVISOR(k)), prec);
 
-            if (len == 1)
-                acb_mul(t, p1, p2, prec);
-            else
-                _acb_poly_mullow(t, p1, len, p2, len, len, prec);
+            if (len != 1)
+                arb_add(logc, LOG(DIVISOR(k)), LOG(k / DIVISOR(k)), prec);
+            logt = logc;
         }
 
         if (k * 3 <= n)
-            _acb_vec_set(POWER(k), t, len);
+        {
+            acb_set(POWER(k), t);
+            if (len != 1)
+                arb_set(LOG(k), logt);
+        }
 
-        _acb_vec_add(u, u, t, len, prec);
+        _acb_poly_powsum_add_term(u, t, logt, v2, len, prec);
 
         while (k == horner_point && power_of_two != 1)
         {
-            _acb_poly_mullow(t, z, len, x, len, len, prec);
-            _acb_vec_add(z, t, u, len, prec);
+            _acb_poly_powsum_horner_step(z, u, x, t, tmp, len, prec);
 
             power_of_two /= 2;
             horner_point = n / power_of_two;
@@ -149,16 +160,19 @@ _acb_poly_powsum_one_series_sieved(acb_ptr z, const acb_t s, long n, long len, l
         }
     }
 
-    _acb_poly_mullow(t, z, len, x, len, len, prec);
-    _acb_vec_add(z, t, u, len, prec);
+    _acb_poly_powsum_horner_step(z, u, x, t, tmp, len, prec);
 
     flint_free(divisors);
     _acb_vec_clear(powers, powers_alloc);
+    if (len != 1)
+        _arb_vec_clear(logs, powers_alloc);
     _acb_vec_clear(t, len);
     _acb_vec_clear(u, len);
     _acb_vec_clear(x, len);
+    _acb_vec_clear(tmp, len);
+    acb_clear(v2);
     arb_clear(logk);
+    arb_clear(logc);
     arb_clear(v);
     arb_clear(w);
 }
-
@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("multipoint....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        long i, j, n, qbits1, qbits2, rbits1, rbits2;
+        fmpq_poly_t P;
+        acb_poly_t R, S, T;
+        fmpq_t t, u;
+        acb_ptr xs, ys, zs;
+        acb_poly_multipoint_t M;
+
+        fmpq_poly_init(P);
+        acb_poly_init(R);
+        acb_poly_init(S);
+        acb_poly_init(T);
+        fmpq_init(t);
+        fmpq_init(u);
+
+        n = n_randint(state, 30);
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 5);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+
+        xs = _acb_vec_init(n);
+        ys = _acb_vec_init(n);
+        zs = _acb_vec_init(n);
+
+        if (n > 0)
+        {
+            fmpq_randtest(t, state, qbits2);
+            acb_set_fmpq(xs, t, rbits2);
+
+            for (i = 1; i < n; i++)
+            {
+                fmpq_randtest_not_zero(u, state, qbits2);
+                fmpq_abs(u, u);
+                fmpq_add(t, t, u);
+                acb_set_fmpq(xs + i, t, rbits2);
+            }
+        }
+
+        acb_poly_multipoint_init(M, xs, n, rbits2);
+
+        /* the same object is reused for several polynomials */
+        for (j = 0; j < 3; j++)
+        {
+            fmpq_poly_randtest(P, state, 1 + n_randint(state, 2 * n + 1),
+                qbits1);
+            acb_poly_set_fmpq_poly(R, P, rbits1);
+
+            acb_poly_multipoint_evaluate(ys, M, R, rbits2);
+            acb_poly_evaluate_vec_fast(zs, R, xs, n, rbits2);
+
+            for (i = 0; i < n; i++)
+            {
+                if (!acb_overlaps(ys + i, zs + i))
+                {
+                    printf("FAIL (evaluate, n = %ld, i = %ld)\n\n", n, i);
+                    abort();
+                }
+            }
+
+            if (P->length > n)
+                continue;
+
+            acb_poly_multipoint_interpolate(S, M, ys, rbits2);
+            acb_poly_interpolate_fast(T, xs, ys, n, rbits2);
+
+            if (!acb_poly_equal(S, T) || !acb_poly_contains_fmpq_poly(S, P))
+            {
+                printf("FAIL (interpolate)\n");
+                printf("P = "); fmpq_poly_print(P); printf("\n\n");
+                printf("S = "); acb_poly_printd(S, 15); printf("\n\n");
+                printf("T = "); acb_poly_printd(T, 15); printf("\n\n");
+                abort();
+            }
+        }
+
+        acb_poly_multipoint_clear(M);
+
+        fmpq_poly_clear(P);
+        acb_poly_clear(R);
+        acb_poly_clear(S);
+        acb_poly_clear(T);
+        fmpq_clear(t);
+        fmpq_clear(u);
+        _acb_vec_clear(xs, n);
+        _acb_vec_clear(ys, n);
+        _acb_vec_clear(zs, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -23,6 +23,7 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "acb_poly.h"
 
 acb_ptr * _acb_poly_tree_alloc(long len)
@@ -54,10 +55,86 @@ void _acb_poly_tree_free(acb_ptr * tree, long len)
     }
 }
 
+/* computes the products for blocks start, ..., stop - 1 of one level,
+   where each block consists of two factors of length pow + 1 */
+static void
+_acb_poly_tree_build_blocks(acb_ptr pb, acb_srcptr pa, long pow,
+    long start, long stop, long prec)
+{
+    long j;
+
+    for (j = start; j < stop; j++)
+        _acb_poly_mul_monic(pb + j * (2 * pow + 1),
+            pa + j * (2 * pow + 2), pow + 1,
+            pa + j * (2 * pow + 2) + pow + 1, pow + 1, prec);
+}
+
+typedef struct
+{
+    acb_ptr pb;
+    acb_srcptr pa;
+    long pow;
+    long start;
+    long stop;
+    long prec;
+}
+tree_build_arg_t;
+
+static void *
+_acb_poly_tree_build_worker(void * arg_ptr)
+{
+    tree_build_arg_t arg = *((tree_build_arg_t *) arg_ptr);
+
+    _acb_poly_tree_build_blocks(arg.pb, arg.pa, arg.pow,
+        arg.start, arg.stop, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* the blocks of a level are independent and can be split over threads */
+static void
+_acb_poly_tree_build_level(acb_ptr pb, acb_srcptr pa, long pow,
+    long num, long prec)
+{
+    long i, num_threads;
+    pthread_t * threads;
+    tree_build_arg_t * args;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    if (num_threads <= 1 ||
+        (double) num * pow * prec < ACB_POLY_TREE_THREAD_CUTOFF)
+    {
+        _acb_poly_tree_build_blocks(pb, pa, pow, 0, num, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(tree_build_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].pb = pb;
+        args[i].pa = pa;
+        args[i].pow = pow;
+        args[i].start = (num * i) / num_threads;
+        args[i].stop = (num * (i + 1)) / num_threads;
+        args[i].prec = prec;
+        pthread_create(&threads[i], NULL, _acb_poly_tree_build_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, long len, long prec)
 {
-    long height, pow, left, i;
+    long height, pow, left, num, i;
     acb_ptr pa, pb;
     acb_srcptr a, b;
 
@@ -98,18 +175,14 @@ _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, long len, long prec)
 
     for (i = 1; i < height - 1; i++)
     {
-        left = len;
         pow = 1L << i;
-        pa = tree[i];
-        pb = tree[i + 1];
+        num = len / (2 * pow);
+        left = len - num * 2 * pow;
 
-        while (left >= 2 * pow)
-        {
-            _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, pow + 1, prec);
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow + 1;
-        }
+        _acb_poly_tree_build_level(tree[i + 1], tree[i], pow, num, prec);
+
+        pa = tree[i] + num * (2 * pow + 2);
+        pb = tree[i + 1] + num * (2 * pow + 1);
 
         if (left > pow)
         {
@@ -0,0 +1,74 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_zeta_cpx_series_fmpq(acb_ptr z, const acb_t s, const fmpq_t a, int deflate, long d, long prec)
+{
+    ulong M, N;
+    long i;
+    arf_t bound;
+    arb_ptr vb;
+    acb_t t;
+
+    if (d < 1)
+        return;
+
+    if (fmpq_sgn(a) <= 0)
+    {
+        printf("_acb_poly_zeta_cpx_series_fmpq: require a > 0\n");
+        abort();
+    }
+
+    if (!acb_is_finite(s))
+    {
+        _acb_vec_indeterminate(z, d);
+        return;
+    }
+
+    arf_init(bound);
+    vb = _arb_vec_init(d);
+    acb_init(t);
+
+    /* the parameter choice and error bound only need a to low precision */
+    acb_set_fmpq(t, a, MAG_BITS);
+
+    _acb_poly_zeta_em_choose_param(bound, &N, &M, s, t, FLINT_MIN(d, 2), prec, MAG_BITS);
+    _acb_poly_zeta_em_bound(vb, s, t, N, M, d, MAG_BITS);
+
+    _acb_poly_zeta_em_sum_fmpq(z, s, a, deflate, N, M, d, prec);
+
+    for (i = 0; i < d; i++)
+    {
+        arb_get_abs_ubound_arf(bound, vb + i, MAG_BITS);
+        arb_add_error_arf(acb_realref(z + i), bound);
+        arb_add_error_arf(acb_imagref(z + i), bound);
+    }
+
+    arf_clear(bound);
+    _arb_vec_clear(vb, d);
+    acb_clear(t);
+}
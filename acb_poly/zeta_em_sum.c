@@ -43,8 +43,10 @@ void _acb_poly_mullow_cpx(acb_ptr res, acb_srcptr src, long len, const acb_t c,
 }
 
 
-void
-_acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, long d, long prec)
+/* aq is either NULL or an exact rational value of a */
+static void
+_acb_poly_zeta_em_sum_main(acb_ptr z, const acb_t s, const acb_t a,
+    const fmpq * aq, int deflate, ulong N, ulong M, long d, long prec)
 {
     acb_ptr t, u, v, term, sum;
     acb_t Na, one;
@@ -61,13 +63,36 @@ _acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulon
     prec += 2 * (FLINT_BIT_COUNT(N) + FLINT_BIT_COUNT(d));
     acb_one(one);
 
-    /* sum 1/(k+a)^(s+x) */
-    if (acb_is_one(a) && d <= 3)
-        _acb_poly_powsum_one_series_sieved(sum, s, N, d, prec);
-    else if (N > 50 && flint_get_num_threads() > 1)
+    /* sum 1/(k+a)^(s+x); the threaded naive algorithm is preferred
+       for long sums whenever several threads are available */
+    if (N > 50 && flint_get_num_threads() > 1)
+    {
         _acb_poly_powsum_series_naive_threaded(sum, s, a, one, N, d, prec);
+    }
+    else if (acb_is_one(a))
+    {
+        _acb_poly_powsum_one_series_sieved(sum, s, N, d, prec);
+    }
+    else if (aq != NULL && fmpq_sgn(aq) > 0)
+    {
+        _acb_poly_powsum_fmpq_series(sum, s, aq, N, d, prec);
+    }
+    else if (arb_is_zero(acb_imagref(a)) && arb_is_exact(acb_realref(a))
+        && arf_sgn(arb_midref(acb_realref(a))) > 0
+        && arf_is_int_2exp_si(arb_midref(acb_realref(a)), -16)
+        && arf_cmpabs_2exp_si(arb_midref(acb_realref(a)), 32) < 0)
+    {
+        /* a = p / 2^e with small p and e */
+        fmpq_t b;
+        fmpq_init(b);
+        arf_get_fmpq(b, arb_midref(acb_realref(a)));
+        _acb_poly_powsum_fmpq_series(sum, s, b, N, d, prec);
+        fmpq_clear(b);
+    }
     else
+    {
         _acb_poly_powsum_series_naive(sum, s, a, one, N, d, prec);
+    }
 
     /* t = 1/(N+a)^(s+x); we might need one extra term for deflation */
     acb_add_ui(Na, a, N, prec);
@@ -145,3 +170,18 @@ _acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulon
     acb_clear(one);
 }
 
+void
+_acb_poly_zeta_em_sum(acb_ptr z, const acb_t s, const acb_t a, int deflate, ulong N, ulong M, long d, long prec)
+{
+    _acb_poly_zeta_em_sum_main(z, s, a, NULL, deflate, N, M, d, prec);
+}
+
+void
+_acb_poly_zeta_em_sum_fmpq(acb_ptr z, const acb_t s, const fmpq_t a, int deflate, ulong N, ulong M, long d, long prec)
+{
+    acb_t t;
+    acb_init(t);
+    acb_set_fmpq(t, a, prec + 2 * (FLINT_BIT_COUNT(N) + FLINT_BIT_COUNT(d)));
+    _acb_poly_zeta_em_sum_main(z, s, t, a, deflate, N, M, d, prec);
+    acb_clear(t);
+}
@@ -574,11 +574,42 @@ void arb_rgamma(arb_t z, const arb_t x, long prec);
 void arb_gamma(arb_t z, const arb_t x, long prec);
 void arb_gamma_fmpq(arb_t z, const fmpq_t x, long prec);
 void arb_gamma_fmpz(arb_t z, const fmpz_t x, long prec);
+
+#define ARB_GAMMA_FMPQ_CACHE_MAX_Q 24
+
+void arb_gamma_small_frac_cached(arb_t y, ulong p, ulong q, long prec);
+void arb_gamma_fmpq_cache_cleanup(void);
 void arb_digamma(arb_t y, const arb_t x, long prec);
+
+#define ARB_GAMMA_STIRLING_CACHE_MAX_PREC 16384
+
+void _arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, long prec);
+void arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, long prec);
+arb_srcptr arb_gamma_stirling_coeffs_cached(long n, int digamma, long prec);
+void arb_gamma_stirling_cache_cleanup(void);
 void arb_zeta(arb_t z, const arb_t s, long prec);
 void arb_zeta_ui(arb_t z, ulong n, long prec);
 void arb_bernoulli_ui(arb_t z, ulong n, long prec);
 
+typedef struct
+{
+    ulong m;
+    fmpz * s;
+    fmpz * d;
+}
+arb_rising_plan_struct;
+
+typedef arb_rising_plan_struct arb_rising_plan_t[1];
+
+#define ARB_RISING_PLAN_CACHE_MAX_M 128
+
+extern TLS_PREFIX arb_rising_plan_struct * arb_rising_plan_cache;
+
+void arb_rising_plan_init(arb_rising_plan_t plan, ulong m);
+void arb_rising_plan_clear(arb_rising_plan_t plan);
+const arb_rising_plan_struct * arb_rising_plan_cached(ulong m);
+void arb_rising_plan_cleanup(void);
+
 void arb_rising_ui_bs(arb_t y, const arb_t x, ulong n, long prec);
 void arb_rising_ui_rs(arb_t y, const arb_t x, ulong n, ulong m, long prec);
 void arb_rising_ui_rec(arb_t y, const arb_t x, ulong n, long prec);
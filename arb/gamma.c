@@ -344,25 +344,6 @@ arb_gamma_stirling_bound(mag_ptr err, const arb_t x, long k0, long knum, long n)
     acb_clear(z);
 }
 
-void
-arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, long prec)
-{
-    fmpz_t d;
-    fmpz_init(d);
-
-    BERNOULLI_ENSURE_CACHED(2 * k);
-
-    arb_set_round_fmpz(b, fmpq_numref(bernoulli_cache + 2 * k), prec);
-
-    if (digamma)
-        fmpz_mul_ui(d, fmpq_denref(bernoulli_cache + 2 * k), 2 * k);
-    else
-        fmpz_mul2_uiui(d, fmpq_denref(bernoulli_cache + 2 * k), 2 * k, 2 * k - 1);
-
-    arb_div_fmpz(b, b, d, prec);
-    fmpz_clear(d);
-}
-
 void
 arb_gamma_stirling_eval(arb_t s, const arb_t z, long nterms, int digamma, long prec)
 {
@@ -387,6 +368,11 @@ arb_gamma_stirling_eval(arb_t s, const arb_t z, long nterms, int digamma, long p
 
     if (nterms > 1)
     {
+        arb_srcptr c = NULL;
+
+        if (prec <= ARB_GAMMA_STIRLING_CACHE_MAX_PREC)
+            c = arb_gamma_stirling_coeffs_cached(nterms, digamma, prec);
+
         arb_mul(zinv2, zinv, zinv, prec);
 
         z_mag = arf_get_d(arb_midref(logz), ARF_RND_UP) * 1.44269504088896;
@@ -407,7 +393,11 @@ arb_gamma_stirling_eval(arb_t s, const arb_t z, long nterms, int digamma, long p
             else
                 arb_mul(s, s, zinv2, term_prec);
 
-            arb_gamma_stirling_coeff(b, k, digamma, term_prec);
+            if (c != NULL)
+                arb_set_round(b, c + k, term_prec);
+            else
+                _arb_gamma_stirling_coeff(b, k, digamma, term_prec);
+
             arb_add(s, s, b, term_prec);
         }
 
@@ -647,6 +637,10 @@ arb_gamma_small_frac(arb_t y, unsigned int p, unsigned int q, long prec)
 
         arb_clear(t);
     }
+    else if (q <= ARB_GAMMA_FMPQ_CACHE_MAX_Q)
+    {
+        arb_gamma_small_frac_cached(y, p, q, prec);
+    }
     else
     {
         printf("small fraction not implemented!\n");
@@ -692,7 +686,7 @@ arb_gamma_fmpq_outward(arb_t y, const fmpq_t x, long prec)
     p = *fmpq_numref(a);
     q = *fmpq_denref(a);
 
-    if (q == 1 || q == 2 || q == 3 || q == 4 || q == 6)
+    if (q <= ARB_GAMMA_FMPQ_CACHE_MAX_Q)
     {
         arb_gamma_small_frac(t, p, q, prec);
     }
@@ -728,7 +722,9 @@ arb_gamma_fmpq(arb_t y, const fmpq_t x, long prec)
     p = *fmpq_numref(x);
     q = *fmpq_denref(x);
 
-    if ((q == 1 || q == 2 || q == 3 || q == 4 || q == 6) && !COEFF_IS_MPZ(p))
+    /* denominators other than 1, 2, 3, 4, 6 use cached values
+       of gamma(p/q), 0 < p/q < 1 */
+    if (q <= ARB_GAMMA_FMPQ_CACHE_MAX_Q && !COEFF_IS_MPZ(p))
     {
         if (q == 1)
         {
@@ -0,0 +1,110 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+void arb_gamma_fmpq_stirling(arb_t y, const fmpq_t a, long prec);
+
+/* vals[q][p] = Gamma(p/q) for 0 < p < q, gcd(p, q) = 1, accurate to
+   at least precs[q][p] bits (zero if not computed) */
+static TLS_PREFIX arb_ptr gamma_frac_vals[ARB_GAMMA_FMPQ_CACHE_MAX_Q + 1];
+static TLS_PREFIX long * gamma_frac_precs[ARB_GAMMA_FMPQ_CACHE_MAX_Q + 1];
+static TLS_PREFIX int gamma_frac_registered = 0;
+
+void
+arb_gamma_fmpq_cache_cleanup(void)
+{
+    ulong q;
+
+    for (q = 1; q <= ARB_GAMMA_FMPQ_CACHE_MAX_Q; q++)
+    {
+        if (gamma_frac_vals[q] != NULL)
+        {
+            _arb_vec_clear(gamma_frac_vals[q], q);
+            flint_free(gamma_frac_precs[q]);
+            gamma_frac_vals[q] = NULL;
+            gamma_frac_precs[q] = NULL;
+        }
+    }
+}
+
+void
+arb_gamma_small_frac_cached(arb_t y, ulong p, ulong q, long prec)
+{
+    if (p == 0 || p >= q || q > ARB_GAMMA_FMPQ_CACHE_MAX_Q
+        || n_gcd(q, p) != 1)
+    {
+        printf("arb_gamma_small_frac_cached: invalid fraction\n");
+        abort();
+    }
+
+    if (!gamma_frac_registered)
+    {
+        flint_register_cleanup_function(arb_gamma_fmpq_cache_cleanup);
+        gamma_frac_registered = 1;
+    }
+
+    if (gamma_frac_vals[q] == NULL)
+    {
+        gamma_frac_vals[q] = _arb_vec_init(q);
+        gamma_frac_precs[q] = flint_calloc(q, sizeof(long));
+    }
+
+    if (gamma_frac_precs[q][p] < prec)
+    {
+        /* a few guard bits, since the value will typically be
+           multiplied by a rising factorial */
+        arb_ptr v = gamma_frac_vals[q] + p;
+        long wp = prec + 8;
+        fmpq_t a;
+
+        fmpq_init(a);
+        fmpz_set_ui(fmpq_numref(a), p);
+        fmpz_set_ui(fmpq_denref(a), q);
+
+        if (2 * p > q)
+        {
+            /* gamma(p/q) = pi / (sin(pi p/q) gamma(1-p/q)) */
+            arb_t t;
+            arb_init(t);
+            arb_gamma_small_frac_cached(t, q - p, q, wp);
+            arb_sin_pi_fmpq(v, a, wp);
+            arb_mul(t, t, v, wp);
+            arb_const_pi(v, wp);
+            arb_div(v, v, t, wp);
+            arb_clear(t);
+        }
+        else
+        {
+            arb_gamma_fmpq_stirling(v, a, wp);
+        }
+
+        fmpq_clear(a);
+        gamma_frac_precs[q][p] = prec;
+    }
+
+    arb_set_round(y, gamma_frac_vals[q] + p, prec);
+}
+
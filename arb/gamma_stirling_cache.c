@@ -0,0 +1,135 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+#include "bernoulli.h"
+
+/* entry k of cache[digamma] holds B_{2k} / (2k (2k-1)), respectively
+   B_{2k} / (2k), at precision cache_prec[digamma]; entry 0 is unused */
+static TLS_PREFIX arb_ptr stirling_cache[2] = { NULL, NULL };
+static TLS_PREFIX long stirling_cache_num[2] = { 0, 0 };
+static TLS_PREFIX long stirling_cache_prec[2] = { 0, 0 };
+static TLS_PREFIX int stirling_cache_registered = 0;
+
+void
+arb_gamma_stirling_cache_cleanup(void)
+{
+    int i;
+
+    for (i = 0; i < 2; i++)
+    {
+        _arb_vec_clear(stirling_cache[i], stirling_cache_num[i]);
+        stirling_cache[i] = NULL;
+        stirling_cache_num[i] = 0;
+        stirling_cache_prec[i] = 0;
+    }
+}
+
+void
+_arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, long prec)
+{
+    fmpz_t d;
+    fmpz_init(d);
+
+    BERNOULLI_ENSURE_CACHED(2 * k);
+
+    arb_set_round_fmpz(b, fmpq_numref(bernoulli_cache + 2 * k), prec);
+
+    if (digamma)
+        fmpz_mul_ui(d, fmpq_denref(bernoulli_cache + 2 * k), 2 * k);
+    else
+        fmpz_mul2_uiui(d, fmpq_denref(bernoulli_cache + 2 * k), 2 * k, 2 * k - 1);
+
+    arb_div_fmpz(b, b, d, prec);
+    fmpz_clear(d);
+}
+
+arb_srcptr
+arb_gamma_stirling_coeffs_cached(long n, int digamma, long prec)
+{
+    long k, old_num, new_num;
+    arb_ptr cache;
+
+    digamma = (digamma != 0);
+
+    if (prec > ARB_GAMMA_STIRLING_CACHE_MAX_PREC)
+    {
+        printf("arb_gamma_stirling_coeffs_cached: precision too large\n");
+        abort();
+    }
+
+    if (!stirling_cache_registered)
+    {
+        flint_register_cleanup_function(arb_gamma_stirling_cache_cleanup);
+        stirling_cache_registered = 1;
+    }
+
+    old_num = stirling_cache_num[digamma];
+
+    /* recompute everything at the larger precision */
+    if (prec > stirling_cache_prec[digamma])
+    {
+        stirling_cache_prec[digamma] = prec;
+        for (k = 1; k < old_num; k++)
+            _arb_gamma_stirling_coeff(stirling_cache[digamma] + k, k, digamma, prec);
+    }
+
+    if (n > old_num)
+    {
+        new_num = FLINT_MAX(n, old_num + 16);
+
+        stirling_cache[digamma] = flint_realloc(stirling_cache[digamma],
+            new_num * sizeof(arb_struct));
+
+        cache = stirling_cache[digamma];
+
+        for (k = old_num; k < new_num; k++)
+        {
+            arb_init(cache + k);
+            if (k != 0)
+                _arb_gamma_stirling_coeff(cache + k, k, digamma,
+                    stirling_cache_prec[digamma]);
+        }
+
+        stirling_cache_num[digamma] = new_num;
+    }
+
+    return stirling_cache[digamma];
+}
+
+void
+arb_gamma_stirling_coeff(arb_t b, ulong k, int digamma, long prec)
+{
+    if (prec <= ARB_GAMMA_STIRLING_CACHE_MAX_PREC)
+    {
+        arb_srcptr c = arb_gamma_stirling_coeffs_cached(k + 1, digamma, prec);
+        arb_set_round(b, c + k, prec);
+    }
+    else
+    {
+        _arb_gamma_stirling_coeff(b, k, digamma, prec);
+    }
+}
+
@@ -127,7 +127,12 @@ arb_rising2_ui_rs(arb_t u, arb_t v,
             a = i;
             b = FLINT_MIN(n, a + m);
 
-            if (a == 0 || b != a + m)
+            if (a == 0 && b == m && m <= ARB_RISING_PLAN_CACHE_MAX_M)
+            {
+                /* x(x+1)...(x+m-1) has Stirling number coefficients */
+                _fmpz_vec_set(A, arb_rising_plan_cached(m)->s, m + 1);
+            }
+            else if (a == 0 || b != a + m)
             {
                 _gamma_rf_bsplit(A, a, b);
             }
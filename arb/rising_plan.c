@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+void rising_difference_polynomial(fmpz * s, fmpz * c, ulong m);
+
+TLS_PREFIX arb_rising_plan_struct * arb_rising_plan_cache = NULL;
+
+void
+arb_rising_plan_init(arb_rising_plan_t plan, ulong m)
+{
+    plan->m = m;
+    plan->s = _fmpz_vec_init(m + 1);
+    plan->d = _fmpz_vec_init(m * m);
+    rising_difference_polynomial(plan->s, plan->d, m);
+}
+
+void
+arb_rising_plan_clear(arb_rising_plan_t plan)
+{
+    _fmpz_vec_clear(plan->s, plan->m + 1);
+    _fmpz_vec_clear(plan->d, plan->m * plan->m);
+}
+
+void
+arb_rising_plan_cleanup(void)
+{
+    ulong m;
+
+    if (arb_rising_plan_cache == NULL)
+        return;
+
+    for (m = 1; m <= ARB_RISING_PLAN_CACHE_MAX_M; m++)
+        if (arb_rising_plan_cache[m].m != 0)
+            arb_rising_plan_clear(arb_rising_plan_cache + m);
+
+    flint_free(arb_rising_plan_cache);
+    arb_rising_plan_cache = NULL;
+}
+
+const arb_rising_plan_struct *
+arb_rising_plan_cached(ulong m)
+{
+    if (m < 1 || m > ARB_RISING_PLAN_CACHE_MAX_M)
+    {
+        printf("arb_rising_plan_cached: m out of range\n");
+        abort();
+    }
+
+    if (arb_rising_plan_cache == NULL)
+    {
+        arb_rising_plan_cache = flint_calloc(ARB_RISING_PLAN_CACHE_MAX_M + 1,
+            sizeof(arb_rising_plan_struct));
+        flint_register_cleanup_function(arb_rising_plan_cleanup);
+    }
+
+    if (arb_rising_plan_cache[m].m == 0)
+        arb_rising_plan_init(arb_rising_plan_cache + m, m);
+
+    return arb_rising_plan_cache + m;
+}
+
@@ -48,7 +48,7 @@ int main()
         fmpq_init(q);
 
         pp = -100 + n_randint(state, 10000);
-        qq = 1 + n_randint(state, 20);
+        qq = 1 + n_randint(state, 30);
         fmpq_set_si(q, pp, qq);
 
         arb_gamma_fmpq(r, q, prec);
@@ -81,6 +81,9 @@ int main()
             }
         }
 
+        if (n_randint(state, 1000) == 0)
+            arb_gamma_fmpq_cache_cleanup();
+
         arb_clear(r);
         arb_clear(s);
         fmpq_clear(q);
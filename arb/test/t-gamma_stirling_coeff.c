@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main(void)
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("gamma_stirling_coeff....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        arb_t a, b;
+        arb_srcptr c;
+        long n, k, prec, prec2;
+        int digamma;
+
+        arb_init(a);
+        arb_init(b);
+
+        n = 2 + n_randint(state, 100);
+        k = 1 + n_randint(state, n - 1);
+        digamma = n_randint(state, 2);
+        prec = 2 + n_randint(state, 1000);
+        prec2 = 2 + n_randint(state, 1000);
+
+        c = arb_gamma_stirling_coeffs_cached(n, digamma, prec);
+        _arb_gamma_stirling_coeff(a, k, digamma, prec);
+
+        if (!arb_overlaps(a, c + k))
+        {
+            printf("FAIL: overlap (vector)\n\n");
+            printf("k = %ld, digamma = %d, prec = %ld\n\n", k, digamma, prec);
+            printf("a = "); arb_printd(a, 30); printf("\n\n");
+            printf("c = "); arb_printd(c + k, 30); printf("\n\n");
+            abort();
+        }
+
+        arb_gamma_stirling_coeff(b, k, digamma, prec2);
+        _arb_gamma_stirling_coeff(a, k, digamma, prec2);
+
+        if (!arb_overlaps(a, b) || arb_rel_accuracy_bits(b) < prec2 - 4)
+        {
+            printf("FAIL: overlap or accuracy\n\n");
+            printf("k = %ld, digamma = %d, prec2 = %ld\n\n", k, digamma, prec2);
+            printf("a = "); arb_printd(a, 30); printf("\n\n");
+            printf("b = "); arb_printd(b, 30); printf("\n\n");
+            abort();
+        }
+
+        if (n_randint(state, 100) == 0)
+            arb_gamma_stirling_cache_cleanup();
+
+        arb_clear(a);
+        arb_clear(b);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
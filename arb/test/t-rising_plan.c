@@ -0,0 +1,75 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arith.h"
+#include "arb.h"
+
+int main(void)
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("rising_plan....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        const arb_rising_plan_struct * plan;
+        arb_rising_plan_t fresh;
+        fmpz * s;
+        ulong m;
+
+        m = 1 + n_randint(state, ARB_RISING_PLAN_CACHE_MAX_M);
+
+        plan = arb_rising_plan_cached(m);
+        arb_rising_plan_init(fresh, m);
+
+        s = _fmpz_vec_init(m + 1);
+        arith_stirling_number_1u_vec(s, m, m + 1);
+
+        if (plan->m != m || !_fmpz_vec_equal(plan->s, s, m + 1)
+            || !_fmpz_vec_equal(plan->s, fresh->s, m + 1)
+            || !_fmpz_vec_equal(plan->d, fresh->d, m * m))
+        {
+            printf("FAIL\n\n");
+            printf("m = %lu\n\n", m);
+            abort();
+        }
+
+        _fmpz_vec_clear(s, m + 1);
+        arb_rising_plan_clear(fresh);
+
+        if (n_randint(state, 100) == 0)
+            arb_rising_plan_cleanup();
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
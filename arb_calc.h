@@ -131,6 +131,11 @@ long arb_calc_isolate_roots(arf_interval_ptr * blocks, int ** flags,
     const arf_interval_t block, long maxdepth, long maxeval, long maxfound,
     long prec);
 
+long arb_calc_isolate_roots_threaded(arf_interval_ptr * blocks, int ** flags,
+    arb_calc_func_t func, void * param,
+    const arf_interval_t block, long maxdepth, long maxeval, long maxfound,
+    long prec);
+
 int arb_calc_refine_root_bisect(arf_interval_t r, arb_calc_func_t func,
     void * param, const arf_interval_t start, long iter, long prec);
 
@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef ARB_CALC_IMPL_H
+#define ARB_CALC_IMPL_H
+
+#include "arb_calc.h"
+
+/* helpers shared by the root isolation and bisection code */
+
+#define BLOCK_NO_ZERO 0
+#define BLOCK_ISOLATED_ZERO 1
+#define BLOCK_UNKNOWN 2
+
+/* 0 means that it *could* be zero; otherwise +/- 1 */
+static __inline__ int
+_arb_sign(const arb_t t)
+{
+    if (arb_is_positive(t))
+        return 1;
+    else if (arb_is_negative(t))
+        return -1;
+    else
+        return 0;
+}
+
+/* value of msign when f has not been evaluated at the midpoint */
+#define SIGN_NOT_EVALUATED 2
+
+static __inline__ void
+_arb_calc_block_midpoint(arf_t u, const arf_interval_t block)
+{
+    arf_add(u, &block->a, &block->b, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(u, u, -1);
+}
+
+/* L, R = block, split at the midpoint */
+static __inline__ void
+_arb_calc_bisect_block(arf_interval_t L, arf_interval_t R,
+    const arf_interval_t block)
+{
+    arf_t u;
+    arf_init(u);
+    _arb_calc_block_midpoint(u, block);
+    arf_set(&L->a, &block->a);
+    arf_set(&R->b, &block->b);
+    arf_set(&L->b, u);
+    arf_set(&R->a, u);
+    arf_clear(u);
+}
+
+/*
+Tests a block with endpoint signs asign and bsign. Returns BLOCK_NO_ZERO,
+BLOCK_UNKNOWN, or BLOCK_ISOLATED_ZERO, in which case res is set to an
+isolating subinterval of the block with known, opposite endpoint signs.
+If f was evaluated at the midpoint of the block, its sign is written
+to msign; otherwise msign is set to SIGN_NOT_EVALUATED.
+*/
+int _arb_calc_check_block(arf_interval_t res, int * msign,
+    arb_calc_func_t func, void * param, const arf_interval_t block,
+    int asign, int bsign, long prec);
+
+#endif
@@ -23,26 +23,99 @@
 
 ******************************************************************************/
 
-#include "arb_calc.h"
+#include "impl.h"
 
-#define BLOCK_NO_ZERO 0
-#define BLOCK_ISOLATED_ZERO 1
-#define BLOCK_UNKNOWN 2
-
-/* 0 means that it *could* be zero; otherwise +/- 1 */
-static __inline__ int
-_arb_sign(const arb_t t)
+/* tries to decide a block on which f is strictly monotonic, deriv being
+   an enclosure of f' on the block, with the interval Newton operator */
+static int
+_arb_calc_newton_block(arf_interval_t res, int * msign,
+    arb_calc_func_t func, void * param, const arf_interval_t block,
+    int asign, int bsign, const arb_t deriv, long prec)
 {
-    if (arb_is_positive(t))
-        return 1;
-    else if (arb_is_negative(t))
-        return -1;
-    else
-        return 0;
+    arb_t m, y;
+    arf_t u, lo, hi;
+    int result, lsign, rsign;
+
+    arb_init(m);
+    arb_init(y);
+    arf_init(u);
+    arf_init(lo);
+    arf_init(hi);
+
+    result = BLOCK_UNKNOWN;
+
+    _arb_calc_block_midpoint(arb_midref(m), block);
+    func(y, m, param, 1, prec);
+    *msign = _arb_sign(y);
+
+    /* any root in the block lies in N = m - f(m) / f'(block) */
+    arb_div(y, y, deriv, prec);
+    arb_sub(y, m, y, prec);
+
+    if (arb_is_finite(y))
+    {
+        arf_set_mag(u, arb_radref(y));
+        arf_sub(lo, arb_midref(y), u, prec, ARF_RND_FLOOR);
+        arf_add(hi, arb_midref(y), u, prec, ARF_RND_CEIL);
+
+        if (arf_cmp(lo, &block->b) > 0 || arf_cmp(hi, &block->a) < 0)
+        {
+            result = BLOCK_NO_ZERO;
+        }
+        else
+        {
+            /* contract the block to its intersection with N, and
+               evaluate the signs at the endpoints that moved */
+            lsign = asign;
+            rsign = bsign;
+
+            if (arf_cmp(lo, &block->a) > 0)
+            {
+                arb_set_arf(m, lo);
+                func(y, m, param, 1, prec);
+                lsign = _arb_sign(y);
+            }
+            else
+            {
+                arf_set(lo, &block->a);
+            }
+
+            if (arf_cmp(hi, &block->b) < 0)
+            {
+                arb_set_arf(m, hi);
+                func(y, m, param, 1, prec);
+                rsign = _arb_sign(y);
+            }
+            else
+            {
+                arf_set(hi, &block->b);
+            }
+
+            if ((lsign < 0 && rsign > 0) || (lsign > 0 && rsign < 0))
+            {
+                arf_set(&res->a, lo);
+                arf_set(&res->b, hi);
+                result = BLOCK_ISOLATED_ZERO;
+            }
+            else if (lsign != 0 && lsign == rsign)
+            {
+                result = BLOCK_NO_ZERO;
+            }
+        }
+    }
+
+    arb_clear(m);
+    arb_clear(y);
+    arf_clear(u);
+    arf_clear(lo);
+    arf_clear(hi);
+
+    return result;
 }
 
-static int
-check_block(arb_calc_func_t func, void * param, const arf_interval_t block,
+int
+_arb_calc_check_block(arf_interval_t res, int * msign,
+    arb_calc_func_t func, void * param, const arf_interval_t block,
     int asign, int bsign, long prec)
 {
     arb_struct t[2];
@@ -53,6 +126,8 @@ check_block(arb_calc_func_t func, void * param, const arf_interval_t block,
     arb_init(t + 1);
     arb_init(x);
 
+    *msign = SIGN_NOT_EVALUATED;
+
     arf_interval_get_arb(x, block, prec);
     func(t, x, param, 1, prec);
 
@@ -62,18 +137,26 @@ check_block(arb_calc_func_t func, void * param, const arf_interval_t block,
     {
         result = BLOCK_NO_ZERO;
     }
-    else
+    else if ((asign < 0 && bsign > 0) || (asign > 0 && bsign < 0))
     {
-        if ((asign < 0 && bsign > 0) || (asign > 0 && bsign < 0))
-        {
-            func(t, x, param, 2, prec);
+        func(t, x, param, 2, prec);
 
-            if (arb_is_finite(t + 1) && !arb_contains_zero(t + 1))
-            {
-                result = BLOCK_ISOLATED_ZERO;
-            }
+        if (arb_is_finite(t + 1) && !arb_contains_zero(t + 1))
+        {
+            arf_interval_set(res, block);
+            result = BLOCK_ISOLATED_ZERO;
         }
     }
+    else if (asign == 0 || bsign == 0)
+    {
+        /* the endpoint signs cannot decide the block, but a Newton
+           step might if f is monotonic */
+        func(t, x, param, 2, prec);
+
+        if (arb_is_finite(t + 1) && !arb_contains_zero(t + 1))
+            result = _arb_calc_newton_block(res, msign, func, param,
+                block, asign, bsign, t + 1, prec);
+    }
 
     arb_clear(t + 0);
     arb_clear(t + 1);
@@ -82,7 +165,7 @@ check_block(arb_calc_func_t func, void * param, const arf_interval_t block,
     return result;
 }
 
-#define ADD_BLOCK       \
+#define ADD_BLOCK(block)       \
     if (*length >= *alloc)   \
     {   \
         long new_alloc;   \
@@ -105,17 +188,22 @@ isolate_roots_recursive(arf_interval_ptr * blocks, int ** flags,
     long depth, long * eval_count, long * found_count,
     long prec)
 {
-    int status;
+    int status, msign;
 
     if (*found_count <= 0 || *eval_count <= 0)
     {
         status = BLOCK_UNKNOWN;
-        ADD_BLOCK
+        ADD_BLOCK(block)
     }
     else
     {
+        arf_interval_t found;
+
+        arf_interval_init(found);
+
         *eval_count -= 1;
-        status = check_block(func, param, block, asign, bsign, prec);
+        status = _arb_calc_check_block(found, &msign,
+            func, param, block, asign, bsign, prec);
 
         if (status != BLOCK_NO_ZERO)
         {
@@ -126,24 +214,32 @@ isolate_roots_recursive(arf_interval_ptr * blocks, int ** flags,
                     if (arb_calc_verbose)
                     {
                         printf("found isolated root in: ");
-                        arf_interval_printd(block, 15);
+                        arf_interval_printd(found, 15);
                         printf("\n");
                     }
 
                     *found_count -= 1;
-                }
 
-                ADD_BLOCK
+                    ADD_BLOCK(found)
+                }
+                else
+                {
+                    ADD_BLOCK(block)
+                }
             }
             else
             {
                 arf_interval_t L, R;
-                int msign;
 
                 arf_interval_init(L);
                 arf_interval_init(R);
 
-                msign = arb_calc_partition(L, R, func, param, block, prec);
+                /* reuse the value at the midpoint if the Newton step
+                   computed it */
+                if (msign == SIGN_NOT_EVALUATED)
+                    msign = arb_calc_partition(L, R, func, param, block, prec);
+                else
+                    _arb_calc_bisect_block(L, R, block);
 
                 if (msign == 0 && arb_calc_verbose)
                 {
@@ -166,6 +262,8 @@ isolate_roots_recursive(arf_interval_ptr * blocks, int ** flags,
                 arf_interval_clear(R);
             }
         }
+
+        arf_interval_clear(found);
     }
 }
 
@@ -0,0 +1,301 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "impl.h"
+
+typedef struct
+{
+    arf_interval_struct block;
+    int asign;
+    int bsign;
+    long depth;
+}
+isolate_task_struct;
+
+typedef struct
+{
+    arf_interval_struct block;
+    int flag;
+}
+isolate_result_struct;
+
+/* State shared between the worker threads. All fields except func,
+   param, verbose and prec are protected by the mutex. */
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+
+    /* stack of blocks waiting to be tested */
+    isolate_task_struct * tasks;
+    long num_tasks;
+    long alloc_tasks;
+
+    /* number of workers currently testing a block */
+    long active;
+
+    isolate_result_struct * results;
+    long num_results;
+    long alloc_results;
+
+    long eval_count;
+    long found_count;
+
+    arb_calc_func_t func;
+    void * param;
+    int verbose;
+    long prec;
+}
+isolate_shared_struct;
+
+static void
+push_task(isolate_shared_struct * S, const arf_interval_t block,
+    int asign, int bsign, long depth)
+{
+    isolate_task_struct * task;
+
+    if (S->num_tasks >= S->alloc_tasks)
+    {
+        S->alloc_tasks = (S->alloc_tasks == 0) ? 16 : 2 * S->alloc_tasks;
+        S->tasks = flint_realloc(S->tasks,
+            sizeof(isolate_task_struct) * S->alloc_tasks);
+    }
+
+    task = S->tasks + S->num_tasks;
+    arf_interval_init(&task->block);
+    arf_interval_set(&task->block, block);
+    task->asign = asign;
+    task->bsign = bsign;
+    task->depth = depth;
+    S->num_tasks++;
+}
+
+static void
+add_result(isolate_shared_struct * S, const arf_interval_t block, int flag)
+{
+    isolate_result_struct * res;
+
+    if (S->num_results >= S->alloc_results)
+    {
+        S->alloc_results = (S->alloc_results == 0) ? 16 : 2 * S->alloc_results;
+        S->results = flint_realloc(S->results,
+            sizeof(isolate_result_struct) * S->alloc_results);
+    }
+
+    res = S->results + S->num_results;
+    arf_interval_init(&res->block);
+    arf_interval_set(&res->block, block);
+    res->flag = flag;
+    S->num_results++;
+}
+
+static int
+_isolate_result_cmp(const void * x, const void * y)
+{
+    return arf_cmp(&((const isolate_result_struct *) x)->block.a,
+                   &((const isolate_result_struct *) y)->block.a);
+}
+
+static void *
+_arb_calc_isolate_roots_worker(void * arg_ptr)
+{
+    isolate_shared_struct * S = (isolate_shared_struct *) arg_ptr;
+    isolate_task_struct task;
+    arf_interval_t L, R, found;
+    int status, msign;
+
+    arf_interval_init(L);
+    arf_interval_init(R);
+    arf_interval_init(found);
+
+    pthread_mutex_lock(&S->mutex);
+
+    while (1)
+    {
+        /* wait until there is work, or until all work is done */
+        while (S->num_tasks == 0 && S->active > 0)
+            pthread_cond_wait(&S->cond, &S->mutex);
+
+        if (S->num_tasks == 0)
+            break;
+
+        S->num_tasks--;
+        task = S->tasks[S->num_tasks];
+
+        if (S->found_count <= 0 || S->eval_count <= 0)
+        {
+            add_result(S, &task.block, BLOCK_UNKNOWN);
+            arf_interval_clear(&task.block);
+            continue;
+        }
+
+        S->eval_count--;
+        S->active++;
+        pthread_mutex_unlock(&S->mutex);
+
+        /* evaluate without holding the lock */
+        status = _arb_calc_check_block(found, &msign, S->func, S->param,
+            &task.block, task.asign, task.bsign, S->prec);
+
+        if (status == BLOCK_UNKNOWN && task.depth > 0)
+        {
+            if (msign == SIGN_NOT_EVALUATED)
+                msign = arb_calc_partition(L, R, S->func, S->param,
+                    &task.block, S->prec);
+            else
+                _arb_calc_bisect_block(L, R, &task.block);
+        }
+
+        pthread_mutex_lock(&S->mutex);
+        S->active--;
+
+        if (status == BLOCK_ISOLATED_ZERO ||
+            (status == BLOCK_UNKNOWN && task.depth <= 0))
+        {
+            if (status == BLOCK_ISOLATED_ZERO)
+            {
+                if (S->verbose)
+                {
+                    printf("found isolated root in: ");
+                    arf_interval_printd(found, 15);
+                    printf("\n");
+                }
+
+                S->found_count--;
+                add_result(S, found, status);
+            }
+            else
+            {
+                add_result(S, &task.block, status);
+            }
+        }
+        else if (status == BLOCK_UNKNOWN)
+        {
+            if (msign == 0 && S->verbose)
+            {
+                printf("possible zero at midpoint: ");
+                arf_interval_printd(&task.block, 15);
+                printf("\n");
+            }
+
+            /* push R first so that the left half is popped first,
+               similar to the order of the serial depth-first search */
+            push_task(S, R, msign, task.bsign, task.depth - 1);
+            push_task(S, L, task.asign, msign, task.depth - 1);
+            pthread_cond_broadcast(&S->cond);
+        }
+
+        arf_interval_clear(&task.block);
+
+        if (S->num_tasks == 0 && S->active == 0)
+            pthread_cond_broadcast(&S->cond);
+    }
+
+    pthread_mutex_unlock(&S->mutex);
+
+    arf_interval_clear(L);
+    arf_interval_clear(R);
+    arf_interval_clear(found);
+
+    flint_cleanup();
+    return NULL;
+}
+
+long
+arb_calc_isolate_roots_threaded(arf_interval_ptr * blocks, int ** flags,
+    arb_calc_func_t func, void * param,
+    const arf_interval_t block, long maxdepth, long maxeval, long maxfound,
+    long prec)
+{
+    isolate_shared_struct S;
+    pthread_t * threads;
+    long i, num_threads;
+    int asign, bsign;
+    arb_t m, v;
+
+    arb_init(m);
+    arb_init(v);
+
+    arb_set_arf(m, &block->a);
+    func(v, m, param, 1, prec);
+    asign = _arb_sign(v);
+
+    arb_set_arf(m, &block->b);
+    func(v, m, param, 1, prec);
+    bsign = _arb_sign(v);
+
+    arb_clear(m);
+    arb_clear(v);
+
+    pthread_mutex_init(&S.mutex, NULL);
+    pthread_cond_init(&S.cond, NULL);
+    S.tasks = NULL;
+    S.num_tasks = 0;
+    S.alloc_tasks = 0;
+    S.active = 0;
+    S.results = NULL;
+    S.num_results = 0;
+    S.alloc_results = 0;
+    S.eval_count = maxeval;
+    S.found_count = maxfound;
+    S.func = func;
+    S.param = param;
+    S.verbose = arb_calc_verbose;
+    S.prec = prec;
+
+    push_task(&S, block, asign, bsign, maxdepth);
+
+    num_threads = flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _arb_calc_isolate_roots_worker, &S);
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    /* the blocks are disjoint, so sorting by the left endpoint gives
+       the same ordering as the serial version */
+    qsort(S.results, S.num_results, sizeof(isolate_result_struct),
+        _isolate_result_cmp);
+
+    *blocks = flint_malloc(sizeof(arf_interval_struct) * S.num_results);
+    *flags = flint_malloc(sizeof(int) * S.num_results);
+
+    for (i = 0; i < S.num_results; i++)
+    {
+        (*blocks)[i] = S.results[i].block;
+        (*flags)[i] = S.results[i].flag;
+    }
+
+    flint_free(threads);
+    flint_free(S.tasks);
+    flint_free(S.results);
+    pthread_mutex_destroy(&S.mutex);
+    pthread_cond_destroy(&S.cond);
+
+    return S.num_results;
+}
@@ -23,51 +23,29 @@
 
 ******************************************************************************/
 
-#include "arb_calc.h"
-
-/* TODO: refactor/combine some of this code with isolate_roots.c */
-
-/* 0 means that it *could* be zero; otherwise +/- 1 */
-static __inline__ int
-_arb_sign(const arb_t t)
-{
-    if (arb_is_positive(t))
-        return 1;
-    else if (arb_is_negative(t))
-        return -1;
-    else
-        return 0;
-}
+#include "impl.h"
 
 int arb_calc_partition(arf_interval_t L, arf_interval_t R,
     arb_calc_func_t func, void * param, const arf_interval_t block, long prec)
 {
     arb_t t, m;
-    arf_t u;
     int msign;
 
     arb_init(t);
     arb_init(m);
-    arf_init(u);
 
     /* Compute the midpoint (TODO: try other points) */
-    arf_add(u, &block->a, &block->b, ARF_PREC_EXACT, ARF_RND_DOWN);
-    arf_mul_2exp_si(u, u, -1);
+    _arb_calc_block_midpoint(arb_midref(m), block);
 
     /* Evaluate and get sign at midpoint */
-    arb_set_arf(m, u);
     func(t, m, param, 1, prec);
     msign = _arb_sign(t);
 
     /* L, R = block, split at midpoint */
-    arf_set(&L->a, &block->a);
-    arf_set(&R->b, &block->b);
-    arf_set(&L->b, u);
-    arf_set(&R->a, u);
+    _arb_calc_bisect_block(L, R, block);
 
     arb_clear(t);
     arb_clear(m);
-    arf_clear(u);
 
     return msign;
 }
@@ -46,6 +46,43 @@ sin_pi2_x(arb_ptr out, const arb_t inp, void * params, long order, long prec)
     return 0;
 }
 
+/* x^2 + x - 1, with a deliberately poor enclosure at x = 0 */
+static int
+golden_poor_at_zero(arb_ptr out, const arb_t inp, void * params,
+    long order, long prec)
+{
+    arb_mul(out, inp, inp, prec);
+    arb_add(out, out, inp, prec);
+    arb_sub_ui(out, out, 1, prec);
+
+    if (arb_is_zero(inp))
+        arb_add_error_2exp_si(out, 2);
+
+    if (order > 1)
+    {
+        arb_mul_2exp_si(out + 1, inp, 1);
+        arb_add_ui(out + 1, out + 1, 1, prec);
+    }
+
+    return 0;
+}
+
+/* x - c where c is only known to lie within 2^-prec of 1/2 */
+static int
+near_half(arb_ptr out, const arb_t inp, void * params,
+    long order, long prec)
+{
+    arb_one(out);
+    arb_mul_2exp_si(out, out, -1);
+    arb_add_error_2exp_si(out, -prec);
+    arb_sub(out, inp, out, prec);
+
+    if (order > 1)
+        arb_one(out + 1);
+
+    return 0;
+}
+
 int main()
 {
     long iter;
@@ -155,6 +192,80 @@ int main()
         fmpz_clear(nn);
     }
 
+    /* blocks which need the Newton test: the sign at an endpoint or at
+       a subdivision point cannot be determined */
+    for (iter = 0; iter < 100; iter++)
+    {
+        long prec, i, num;
+        arf_interval_ptr blocks;
+        int * info;
+        arf_interval_t interval, r;
+        arb_t t, u;
+        int which;
+
+        prec = 10 + n_randint(state, 200);
+        which = n_randint(state, 2);
+
+        arf_interval_init(interval);
+        arf_interval_init(r);
+        arb_init(t);
+        arb_init(u);
+
+        arf_set_si(&interval->a, 0);
+        arf_set_si(&interval->b, 1);
+
+        if (which == 0)
+        {
+            /* the Newton step contracts [0, 1] to an isolating block */
+            num = arb_calc_isolate_roots(&blocks, &info, golden_poor_at_zero,
+                NULL, interval, 30, 1000, LONG_MAX, prec);
+
+            arb_sqrt_ui(u, 5, prec);
+            arb_sub_ui(u, u, 1, prec);
+            arb_mul_2exp_si(u, u, -1);
+        }
+        else
+        {
+            num = arb_calc_isolate_roots(&blocks, &info, near_half,
+                NULL, interval, 30, 1000, LONG_MAX, prec);
+
+            arb_one(u);
+            arb_mul_2exp_si(u, u, -1);
+        }
+
+        if (which == 0 && (num != 1 || info[0] != 1))
+        {
+            printf("FAIL: expected a single isolated root (prec = %ld)\n",
+                prec);
+            abort();
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            arf_interval_get_arb(t, blocks + i, prec);
+
+            if (info[i] == 1 && (arb_calc_refine_root_bisect(r,
+                    which ? near_half : golden_poor_at_zero, NULL,
+                    blocks + i, 5, prec) == ARB_CALC_IMPRECISE_INPUT ||
+                !arb_overlaps(t, u)))
+            {
+                printf("FAIL: bad isolating block (which = %d, prec = %ld)\n",
+                    which, prec);
+                arf_interval_printd(blocks + i, 15);
+                printf("\n");
+                abort();
+            }
+        }
+
+        _arf_interval_vec_clear(blocks, num);
+        flint_free(info);
+
+        arf_interval_clear(interval);
+        arf_interval_clear(r);
+        arb_clear(t);
+        arb_clear(u);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     printf("PASS\n");
@@ -0,0 +1,177 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_calc.h"
+
+/* sin((pi/2)x) */
+static int
+sin_pi2_x(arb_ptr out, const arb_t inp, void * params, long order, long prec)
+{
+    arb_ptr x;
+
+    x = _arb_vec_init(2);
+
+    arb_set(x, inp);
+    arb_one(x + 1);
+
+    arb_const_pi(out, prec);
+    arb_mul_2exp_si(out, out, -1);
+    _arb_vec_scalar_mul(x, x, 2, out, prec);
+    _arb_poly_sin_series(out, x, order, order, prec);
+
+    _arb_vec_clear(x, 2);
+
+    return 0;
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("isolate_roots_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 40; iter++)
+    {
+        long m, r, a, b, maxdepth, maxeval, maxfound, prec, i, j, num, num2;
+        arf_interval_ptr blocks, blocks2;
+        int * info, * info2;
+        arf_interval_t interval;
+        arb_t t;
+
+        flint_set_num_threads(1 + n_randint(state, 5));
+
+        prec = 2 + n_randint(state, 50);
+
+        m = n_randint(state, 80);
+        r = 1 + n_randint(state, 80);
+        a = m - r;
+        b = m + r;
+
+        maxdepth = 1 + n_randint(state, 60);
+        maxeval = 1 + n_randint(state, 5000);
+        maxfound = 1 + n_randint(state, 100);
+
+        arf_interval_init(interval);
+        arb_init(t);
+
+        arf_set_si(&interval->a, a);
+        arf_set_si(&interval->b, b);
+
+        num = arb_calc_isolate_roots_threaded(&blocks, &info, sin_pi2_x, NULL,
+            interval, maxdepth, maxeval, maxfound, prec);
+
+        /* check that all roots are accounted for */
+        for (i = a; i <= b; i++)
+        {
+            if (i % 2 == 0)
+            {
+                int found = 0;
+
+                for (j = 0; j < num; j++)
+                {
+                    arf_interval_get_arb(t, blocks + j, ARF_PREC_EXACT);
+
+                    if (arb_contains_si(t, i))
+                    {
+                        found = 1;
+                        break;
+                    }
+                }
+
+                if (!found)
+                {
+                    printf("FAIL: missing root %ld\n", i);
+                    printf("a = %ld, b = %ld, maxdepth = %ld, maxeval = %ld, maxfound = %ld, prec = %ld\n",
+                        a, b, maxdepth, maxeval, maxfound, prec);
+                    abort();
+                }
+            }
+        }
+
+        /* check that the output is sorted */
+        for (i = 0; i + 1 < num; i++)
+        {
+            if (arf_cmp(&blocks[i].b, &blocks[i + 1].a) > 0)
+            {
+                printf("FAIL: unsorted output\n");
+                printf("a = %ld, b = %ld, maxdepth = %ld, maxeval = %ld, maxfound = %ld, prec = %ld\n",
+                    a, b, maxdepth, maxeval, maxfound, prec);
+                abort();
+            }
+        }
+
+        _arf_interval_vec_clear(blocks, num);
+        flint_free(info);
+
+        /* without limits on the number of evaluations, the output must
+           be identical to that of the serial version */
+        maxdepth = FLINT_MIN(maxdepth, 12);
+
+        num = arb_calc_isolate_roots_threaded(&blocks, &info, sin_pi2_x, NULL,
+            interval, maxdepth, LONG_MAX, LONG_MAX, prec);
+        num2 = arb_calc_isolate_roots(&blocks2, &info2, sin_pi2_x, NULL,
+            interval, maxdepth, LONG_MAX, LONG_MAX, prec);
+
+        if (num != num2)
+        {
+            printf("FAIL: different number of blocks (%ld, %ld)\n", num, num2);
+            printf("a = %ld, b = %ld, maxdepth = %ld, prec = %ld\n",
+                a, b, maxdepth, prec);
+            abort();
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            if (!arf_equal(&blocks[i].a, &blocks2[i].a) ||
+                !arf_equal(&blocks[i].b, &blocks2[i].b) ||
+                info[i] != info2[i])
+            {
+                printf("FAIL: different output\n");
+                printf("a = %ld, b = %ld, maxdepth = %ld, prec = %ld\n",
+                    a, b, maxdepth, prec);
+                arf_interval_printd(blocks + i, 15); printf("   %d\n", info[i]);
+                arf_interval_printd(blocks2 + i, 15); printf("   %d\n", info2[i]);
+                abort();
+            }
+        }
+
+        _arf_interval_vec_clear(blocks, num);
+        _arf_interval_vec_clear(blocks2, num2);
+        flint_free(info);
+        flint_free(info2);
+
+        arf_interval_clear(interval);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
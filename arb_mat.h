@@ -65,6 +65,23 @@ arb_mat_swap(arb_mat_t mat1, arb_mat_t mat2)
     *mat2 = t;
 }
 
+static __inline__ void
+arb_mat_swap_entrywise(arb_mat_t mat1, arb_mat_t mat2)
+{
+    long i, j;
+
+    for (i = 0; i < arb_mat_nrows(mat1); i++)
+        for (j = 0; j < arb_mat_ncols(mat1); j++)
+            arb_swap(arb_mat_entry(mat1, i, j), arb_mat_entry(mat2, i, j));
+}
+
+/* Window matrices */
+
+void arb_mat_window_init(arb_mat_t window, const arb_mat_t mat,
+    long r1, long c1, long r2, long c2);
+
+void arb_mat_window_clear(arb_mat_t window);
+
 /* Conversions */
 
 void arb_mat_set(arb_mat_t dest, const arb_mat_t src);
@@ -89,6 +106,10 @@ int arb_mat_contains_fmpq_mat(const arb_mat_t mat1, const fmpq_mat_t mat2);
 
 int arb_mat_contains_fmpz_mat(const arb_mat_t mat1, const fmpz_mat_t mat2);
 
+int arb_mat_is_exact(const arb_mat_t A);
+
+int arb_mat_is_symmetric(const arb_mat_t A);
+
 /* Special matrices */
 
 void arb_mat_zero(arb_mat_t mat);
@@ -113,6 +134,17 @@ void arb_mat_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, lo
 
 void arb_mat_mul_threaded(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, long prec);
 
+void arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, long prec);
+
+void _arb_mat_mul_vec(arb_ptr res, const arb_mat_t A, arb_srcptr v, long prec);
+
+void arb_mat_mul_vec(arb_ptr res, const arb_mat_t A, arb_srcptr v, long prec);
+
+void _arb_mat_mul_batch(arb_ptr C, arb_srcptr A, arb_srcptr B,
+    long m, long k, long n, long num, long prec);
+
+void arb_mat_sqr(arb_mat_t B, const arb_mat_t A, long prec);
+
 void arb_mat_pow_ui(arb_mat_t B, const arb_mat_t A, ulong exp, long prec);
 
 /* Scalar arithmetic */
@@ -243,6 +275,12 @@ arb_mat_swap_rows(arb_mat_t mat, long * perm, long r, long s)
 long arb_mat_find_pivot_partial(const arb_mat_t mat,
                                     long start_row, long end_row, long c);
 
+#define ARB_MAT_LU_RECURSIVE_CUTOFF 16
+
+int arb_mat_lu_classical(long * P, arb_mat_t LU, const arb_mat_t A, long prec);
+
+int arb_mat_lu_recursive(long * P, arb_mat_t LU, const arb_mat_t A, long prec);
+
 int arb_mat_lu(long * P, arb_mat_t LU, const arb_mat_t A, long prec);
 
 void arb_mat_solve_lu_precomp(arb_mat_t X, const long * perm,
@@ -250,6 +288,8 @@ void arb_mat_solve_lu_precomp(arb_mat_t X, const long * perm,
 
 int arb_mat_solve(arb_mat_t X, const arb_mat_t A, const arb_mat_t B, long prec);
 
+int arb_mat_solve_precond(arb_mat_t X, const arb_mat_t A, const arb_mat_t B, long prec);
+
 int arb_mat_inv(arb_mat_t X, const arb_mat_t A, long prec);
 
 void arb_mat_det(arb_t det, const arb_mat_t A, long prec);
@@ -134,6 +134,122 @@ arb_mat_det_inplace(arb_t det, arb_mat_t A, long prec)
     }
 }
 
+/*
+Computes the determinant exactly using fmpz_mat_det if all entries of A
+are exact, rounding only the final result. Each row is scaled by a power
+of two to make the entries integers. Returns zero without modifying det
+if A has inexact or nonfinite entries, or if the entries in some row
+span too many bits (in which case working with balls is cheaper).
+*/
+static int
+_arb_mat_det_exact(arb_t det, const arb_mat_t A, long prec)
+{
+    fmpz_mat_t Z;
+    fmpz_t d, e, t, lo, hi;
+    arf_srcptr x;
+    long i, j, n, max_bits;
+    int result, nonzero;
+
+    n = arb_mat_nrows(A);
+    max_bits = 2 * prec + 64;
+
+    if (!arb_mat_is_exact(A))
+        return 0;
+
+    fmpz_mat_init(Z, n, n);
+    fmpz_init(d);
+    fmpz_init(e);
+    fmpz_init(t);
+    fmpz_init(lo);
+    fmpz_init(hi);
+
+    result = 1;
+
+    for (i = 0; i < n && result == 1; i++)
+    {
+        nonzero = 0;
+
+        for (j = 0; j < n; j++)
+        {
+            x = arb_midref(arb_mat_entry(A, i, j));
+
+            if (arf_is_zero(x))
+                continue;
+
+            if (arf_is_special(x))
+            {
+                result = 0;
+                break;
+            }
+
+            arf_bot(t, x);
+
+            if (!nonzero || fmpz_cmp(t, lo) < 0)
+                fmpz_set(lo, t);
+            if (!nonzero || fmpz_cmp(ARF_EXPREF(x), hi) > 0)
+                fmpz_set(hi, ARF_EXPREF(x));
+
+            nonzero = 1;
+        }
+
+        if (result != 1)
+            break;
+
+        /* a zero row gives a zero determinant */
+        if (!nonzero)
+        {
+            result = -1;
+            break;
+        }
+
+        fmpz_sub(t, hi, lo);
+        if (fmpz_cmp_si(t, max_bits) > 0)
+        {
+            result = 0;
+            break;
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            x = arb_midref(arb_mat_entry(A, i, j));
+
+            if (arf_is_zero(x))
+            {
+                fmpz_zero(fmpz_mat_entry(Z, i, j));
+            }
+            else
+            {
+                arf_get_fmpz_2exp(fmpz_mat_entry(Z, i, j), t, x);
+                fmpz_sub(t, t, lo);
+                fmpz_mul_2exp(fmpz_mat_entry(Z, i, j),
+                    fmpz_mat_entry(Z, i, j), fmpz_get_ui(t));
+            }
+        }
+
+        fmpz_add(e, e, lo);
+    }
+
+    if (result == -1)
+    {
+        arb_zero(det);
+        result = 1;
+    }
+    else if (result == 1)
+    {
+        fmpz_mat_det(d, Z);
+        arb_set_round_fmpz_2exp(det, d, e, prec);
+    }
+
+    fmpz_mat_clear(Z);
+    fmpz_clear(d);
+    fmpz_clear(e);
+    fmpz_clear(t);
+    fmpz_clear(lo);
+    fmpz_clear(hi);
+
+    return result;
+}
+
 void
 arb_mat_det(arb_t det, const arb_mat_t A, long prec)
 {
@@ -152,7 +268,7 @@ arb_mat_det(arb_t det, const arb_mat_t A, long prec)
         arb_mul(det, arb_mat_entry(A, 0, 0), arb_mat_entry(A, 1, 1), prec);
         arb_submul(det, arb_mat_entry(A, 0, 1), arb_mat_entry(A, 1, 0), prec);
     }
-    else
+    else if (!_arb_mat_det_exact(det, A, prec))
     {
         arb_mat_t T;
         arb_mat_init(T, arb_mat_nrows(A), arb_mat_ncols(A));
@@ -52,6 +52,69 @@ _arb_mat_exp_choose_N(const mag_t norm, long prec)
     }
 }
 
+/* cost of _arb_mat_exp_taylor, measured in matrix multiplications */
+static double
+_arb_mat_exp_taylor_cost(long N)
+{
+    long m;
+
+    if (N <= 2)
+        return 0.0;
+    if (N == 3)
+        return 1.0;
+
+    m = n_sqrt(N);
+    return (m - 1) + (N + m - 1) / m;
+}
+
+/*
+Chooses the number of squarings r for evaluating exp(A) as
+exp(A/2^r)^(2^r), given a bound for the norm of A and the cost of a
+squaring relative to a general matrix multiplication. Each squaring is
+weighed against the cost of the Taylor series for A/2^r. Squarings
+beyond reducing the norm to 2^(-wp^(1/4)) lose about one bit of
+accuracy each, so wp is increased correspondingly.
+*/
+long
+_arb_mat_exp_choose_r(long * wp, const mag_t norm, double sqr_cost)
+{
+    long r, s, s0, q, N, swp, best_wp;
+    double cost, best_cost;
+    mag_t t;
+
+    if (mag_cmp_2exp_si(norm, 2 * (*wp)) > 0) /* too big */
+        return 2 * (*wp);
+
+    q = pow(*wp, 0.25);
+    s0 = FLINT_MAX(0, MAG_EXP(norm));  /* reduce to magnitude <= 1 */
+
+    mag_init(t);
+
+    r = s0;
+    best_wp = *wp;
+    best_cost = -1.0;
+
+    for (s = s0; s <= s0 + 2 * q; s++)
+    {
+        swp = *wp + FLINT_MAX(0, s - s0 - q);
+        mag_mul_2exp_si(t, norm, -s);
+        N = _arb_mat_exp_choose_N(t, swp);
+        cost = (sqr_cost * s + _arb_mat_exp_taylor_cost(N)) * swp;
+
+        if (best_cost < 0 || cost < best_cost)
+        {
+            r = s;
+            best_wp = swp;
+            best_cost = cost;
+        }
+    }
+
+    mag_clear(t);
+
+    *wp = best_wp;
+    return r;
+}
+
 /* evaluates the truncated Taylor series (assumes no aliasing) */
 void
 _arb_mat_exp_taylor(arb_mat_t S, const arb_mat_t A, long N, long prec)
@@ -69,7 +132,7 @@ _arb_mat_exp_taylor(arb_mat_t S, const arb_mat_t A, long N, long prec)
     {
         arb_mat_t T;
         arb_mat_init(T, arb_mat_nrows(A), arb_mat_nrows(A));
-        arb_mat_mul(T, A, A, prec);
+        arb_mat_sqr(T, A, prec);
         arb_mat_scalar_mul_2exp_si(T, T, -1);
         arb_mat_add(S, A, T, prec);
         arb_mat_one(T);
@@ -100,6 +163,8 @@ _arb_mat_exp_taylor(arb_mat_t S, const arb_mat_t A, long N, long prec)
                 arb_mat_one(pows + i);
             else if (i == 1)
                 arb_mat_set(pows + i, A);
+            else if (i == 2)
+                arb_mat_sqr(pows + i, A, prec);
             else
                 arb_mat_mul(pows + i, pows + i - 1, A, prec);
         }
@@ -144,7 +209,8 @@ _arb_mat_exp_taylor(arb_mat_t S, const arb_mat_t A, long N, long prec)
 void
 arb_mat_exp(arb_mat_t B, const arb_mat_t A, long prec)
 {
-    long i, j, dim, wp, N, q, r;
+    long i, j, dim, wp, N, r;
+    int sym;
     mag_t norm, err;
     arb_mat_t T;
 
@@ -180,14 +246,9 @@ arb_mat_exp(arb_mat_t B, const arb_mat_t A, long prec)
     }
     else
     {
-        q = pow(wp, 0.25);  /* wanted magnitude */
-
-        if (mag_cmp_2exp_si(norm, 2 * wp) > 0) /* too big */
-            r = 2 * wp;
-        else if (mag_cmp_2exp_si(norm, -q) < 0) /* tiny, no need to reduce */
-            r = 0;
-        else
-            r = FLINT_MAX(0, q + MAG_EXP(norm)); /* reduce to magnitude 2^(-r) */
+        /* squaring is cheaper if A, and hence exp(A/2^r), is symmetric */
+        sym = arb_mat_is_symmetric(A);
+        r = _arb_mat_exp_choose_r(&wp, norm, sym ? 0.5 : 1.0);
 
         arb_mat_scalar_mul_2exp_si(T, A, -r);
         mag_mul_2exp_si(norm, norm, -r);
@@ -197,14 +258,20 @@ arb_mat_exp(arb_mat_t B, const arb_mat_t A, long prec)
 
         _arb_mat_exp_taylor(B, T, N, wp);
 
+        /* restore exact symmetry (see arb_mat_pow_ui) */
+        if (sym)
+            for (i = 0; i < dim; i++)
+                for (j = i + 1; j < dim; j++)
+                    arb_set(arb_mat_entry(B, j, i), arb_mat_entry(B, i, j));
+
         for (i = 0; i < dim; i++)
             for (j = 0; j < dim; j++)
                 arb_add_error_mag(arb_mat_entry(B, i, j), err);
 
         for (i = 0; i < r; i++)
         {
-            arb_mat_mul(T, B, B, wp);
-            arb_mat_swap(T, B);
+            arb_mat_sqr(T, B, wp);
+            arb_mat_swap_entrywise(T, B);
         }
 
         for (i = 0; i < dim; i++)
@@ -34,7 +34,7 @@ arb_mat_inv(arb_mat_t X, const arb_mat_t A, long prec)
         arb_mat_t T;
         arb_mat_init(T, arb_mat_nrows(A), arb_mat_ncols(A));
         r = arb_mat_inv(T, A, prec);
-        arb_mat_swap(T, X);
+        arb_mat_swap_entrywise(T, X);
         arb_mat_clear(T);
         return r;
     }
@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_mat.h"
+
+int
+arb_mat_is_symmetric(const arb_mat_t A)
+{
+    long i, j, n;
+
+    n = arb_mat_nrows(A);
+
+    if (arb_mat_ncols(A) != n)
+        return 0;
+
+    for (i = 0; i < n; i++)
+        for (j = i + 1; j < n; j++)
+            if (!arb_equal(arb_mat_entry(A, i, j), arb_mat_entry(A, j, i)))
+                return 0;
+
+    return 1;
+}
@@ -28,60 +28,15 @@
 int
 arb_mat_lu(long * P, arb_mat_t LU, const arb_mat_t A, long prec)
 {
-    arb_t d, e;
-    arb_ptr * a;
-    long i, j, m, n, r, row, col;
-    int result;
-
-    m = arb_mat_nrows(A);
-    n = arb_mat_ncols(A);
-
-    result = 1;
-
-    if (m == 0 || n == 0)
-        return result;
-
-    arb_mat_set(LU, A);
-
-    a = LU->rows;
-
-    row = col = 0;
-    for (i = 0; i < m; i++)
-        P[i] = i;
-
-    arb_init(d);
-    arb_init(e);
-
-    while (row < m && col < n)
+    if (arb_mat_nrows(A) < ARB_MAT_LU_RECURSIVE_CUTOFF ||
+        arb_mat_ncols(A) < ARB_MAT_LU_RECURSIVE_CUTOFF ||
+        arb_mat_nrows(A) < arb_mat_ncols(A))
     {
-        r = arb_mat_find_pivot_partial(LU, row, m, col);
-
-        if (r == -1)
-        {
-            result = 0;
-            break;
-        }
-        else if (r != row)
-            arb_mat_swap_rows(LU, P, row, r);
-
-        arb_set(d, a[row] + col);
-
-        for (j = row + 1; j < m; j++)
-        {
-            arb_div(e, a[j] + col, d, prec);
-            arb_neg(e, e);
-            _arb_vec_scalar_addmul(a[j] + col,
-                a[row] + col, n - col, e, prec);
-            arb_zero(a[j] + col);
-            arb_neg(a[j] + row, e);
-        }
-
-        row++;
-        col++;
+        return arb_mat_lu_classical(P, LU, A, prec);
+    }
+    else
+    {
+        return arb_mat_lu_recursive(P, LU, A, prec);
     }
-
-    arb_clear(d);
-    arb_clear(e);
-
-    return result;
 }
+
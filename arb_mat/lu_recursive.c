@@ -0,0 +1,184 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_mat.h"
+
+/* permutes rows offset, ..., offset + n - 1 of A and of P by Q */
+static void
+_apply_permutation(long * P, arb_mat_t A, const long * Q, long n, long offset)
+{
+    arb_ptr * rows;
+    long * perm;
+    long i;
+
+    rows = flint_malloc(sizeof(arb_ptr) * n);
+    perm = flint_malloc(sizeof(long) * n);
+
+    for (i = 0; i < n; i++)
+    {
+        rows[i] = A->rows[offset + Q[i]];
+        perm[i] = P[offset + Q[i]];
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        A->rows[offset + i] = rows[i];
+        P[offset + i] = perm[i];
+    }
+
+    flint_free(rows);
+    flint_free(perm);
+}
+
+/* B = L^(-1) B where L is unit lower triangular */
+static void
+_solve_tril_unit(const arb_mat_t L, arb_mat_t B, long prec)
+{
+    long i, j, k, n, m;
+
+    n = arb_mat_nrows(L);
+    m = arb_mat_ncols(B);
+
+    if (n < ARB_MAT_LU_RECURSIVE_CUTOFF || m == 0)
+    {
+        for (i = 1; i < n; i++)
+            for (j = 0; j < i; j++)
+                for (k = 0; k < m; k++)
+                    arb_submul(arb_mat_entry(B, i, k),
+                        arb_mat_entry(L, i, j), arb_mat_entry(B, j, k), prec);
+    }
+    else
+    {
+        arb_mat_t L00, L10, L11, B0, B1, T;
+        long r = n / 2;
+
+        arb_mat_window_init(L00, L, 0, 0, r, r);
+        arb_mat_window_init(L10, L, r, 0, n, r);
+        arb_mat_window_init(L11, L, r, r, n, n);
+        arb_mat_window_init(B0, B, 0, 0, r, m);
+        arb_mat_window_init(B1, B, r, 0, n, m);
+
+        _solve_tril_unit(L00, B0, prec);
+
+        arb_mat_init(T, n - r, m);
+        arb_mat_mul(T, L10, B0, prec);
+        arb_mat_sub(B1, B1, T, prec);
+        arb_mat_clear(T);
+
+        _solve_tril_unit(L11, B1, prec);
+
+        arb_mat_window_clear(L00);
+        arb_mat_window_clear(L10);
+        arb_mat_window_clear(L11);
+        arb_mat_window_clear(B0);
+        arb_mat_window_clear(B1);
+    }
+}
+
+/* in-place decomposition of an m x n matrix with m >= n */
+static int
+_arb_mat_lu_recursive(long * P, arb_mat_t A, long prec)
+{
+    arb_mat_t A0, A00, A01, A10, A11, T;
+    long i, m, n, n1, * P1;
+    int result;
+
+    m = arb_mat_nrows(A);
+    n = arb_mat_ncols(A);
+
+    if (n < 4)
+        return arb_mat_lu_classical(P, A, A, prec);
+
+    n1 = n / 2;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    P1 = flint_malloc(sizeof(long) * m);
+
+    /* factor the left half of the columns */
+    arb_mat_window_init(A0, A, 0, 0, m, n1);
+    result = _arb_mat_lu_recursive(P1, A0, prec);
+    arb_mat_window_clear(A0);
+
+    if (result)
+    {
+        _apply_permutation(P, A, P1, m, 0);
+
+        arb_mat_window_init(A00, A, 0, 0, n1, n1);
+        arb_mat_window_init(A01, A, 0, n1, n1, n);
+        arb_mat_window_init(A10, A, n1, 0, m, n1);
+        arb_mat_window_init(A11, A, n1, n1, m, n);
+
+        /* U01 = L00^(-1) A01, then the Schur complement
+           A11 - L10 U01, which is a matrix multiplication */
+        _solve_tril_unit(A00, A01, prec);
+
+        arb_mat_init(T, m - n1, n - n1);
+        arb_mat_mul(T, A10, A01, prec);
+        arb_mat_sub(A11, A11, T, prec);
+        arb_mat_clear(T);
+
+        result = _arb_mat_lu_recursive(P1, A11, prec);
+
+        if (result)
+            _apply_permutation(P, A, P1, m - n1, n1);
+
+        arb_mat_window_clear(A00);
+        arb_mat_window_clear(A01);
+        arb_mat_window_clear(A10);
+        arb_mat_window_clear(A11);
+    }
+
+    flint_free(P1);
+
+    return result;
+}
+
+int
+arb_mat_lu_recursive(long * P, arb_mat_t LU, const arb_mat_t A, long prec)
+{
+    long i, m, n;
+
+    m = arb_mat_nrows(A);
+    n = arb_mat_ncols(A);
+
+    if (m < n)
+    {
+        printf("arb_mat_lu_recursive: requires nrows >= ncols\n");
+        abort();
+    }
+
+    if (m == 0 || n == 0)
+        return 1;
+
+    arb_mat_set(LU, A);
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    return _arb_mat_lu_recursive(P, LU, prec);
+}
+
@@ -0,0 +1,131 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_mat.h"
+#include "pthread.h"
+
+/* computes the products with index start <= l < stop */
+static void
+_arb_mat_mul_batch_range(arb_ptr C, arb_srcptr A, arb_srcptr B,
+    long m, long k, long n, long start, long stop, long prec)
+{
+    arb_ptr c;
+    arb_srcptr a, b;
+    long l, i, j, t;
+
+    for (l = start; l < stop; l++)
+    {
+        a = A + l * m * k;
+        b = B + l * k * n;
+        c = C + l * m * n;
+
+        if (k == 0)
+        {
+            _arb_vec_zero(c, m * n);
+            continue;
+        }
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                arb_mul(c + i * n + j, a + i * k, b + j, prec);
+
+                for (t = 1; t < k; t++)
+                    arb_addmul(c + i * n + j, a + i * k + t,
+                        b + t * n + j, prec);
+            }
+        }
+    }
+}
+
+typedef struct
+{
+    arb_ptr C;
+    arb_srcptr A;
+    arb_srcptr B;
+    long m;
+    long k;
+    long n;
+    long start;
+    long stop;
+    long prec;
+}
+arb_mat_mul_batch_arg_t;
+
+void *
+_arb_mat_mul_batch_thread(void * arg_ptr)
+{
+    arb_mat_mul_batch_arg_t arg = *((arb_mat_mul_batch_arg_t *) arg_ptr);
+
+    _arb_mat_mul_batch_range(arg.C, arg.A, arg.B, arg.m, arg.k, arg.n,
+        arg.start, arg.stop, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_arb_mat_mul_batch(arb_ptr C, arb_srcptr A, arb_srcptr B,
+    long m, long k, long n, long num, long prec)
+{
+    long i, num_threads;
+    pthread_t * threads;
+    arb_mat_mul_batch_arg_t * args;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    if (num_threads <= 1 || ((double) num * (double) m *
+        (double) k * (double) n * (double) prec <= 100000))
+    {
+        _arb_mat_mul_batch_range(C, A, B, m, k, n, 0, num, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(arb_mat_mul_batch_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].C = C;
+        args[i].A = A;
+        args[i].B = B;
+        args[i].m = m;
+        args[i].k = k;
+        args[i].n = n;
+        args[i].start = (num * i) / num_threads;
+        args[i].stop = (num * (i + 1)) / num_threads;
+        args[i].prec = prec;
+        pthread_create(&threads[i], NULL, _arb_mat_mul_batch_thread, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    flint_free(threads);
+    flint_free(args);
+}
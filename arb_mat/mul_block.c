@@ -0,0 +1,467 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include <math.h>
+#include <limits.h>
+#include "arb_mat.h"
+
+/* Break the inner dimension into blocks where each row of A and each
+   column of B has a height of at most ALPHA*prec + BETA bits, so that
+   the midpoints within a block can be represented exactly as integers.
+   These are just tuning parameters (as in arb_poly/mullow_block.c). */
+#define ALPHA 3.0
+#define BETA 512
+
+/* Summing at most DOUBLE_MAX_LENGTH products of nonnegative doubles and
+   multiplying by DOUBLE_ROUNDING_FACTOR gives an upper bound for the
+   exact sum, assuming that no overflow or underflow occurs. */
+#define DOUBLE_MAX_LENGTH 1000000
+#define DOUBLE_ROUNDING_FACTOR (1.0 + 1e-9)
+
+/* Nonzero magnitudes are converted to doubles after dividing by the
+   largest magnitude in the same row (or column); the quotients are
+   rounded up to at least 2^(-DOUBLE_SHIFT) so that products of two
+   of them cannot underflow. */
+#define DOUBLE_SHIFT 400
+
+/* checks that all entries are finite with exponents of moderate size */
+static int
+_arb_mat_is_lagom(const arb_mat_t A)
+{
+    long i, j;
+    arb_srcptr x;
+
+    for (i = 0; i < arb_mat_nrows(A); i++)
+    {
+        for (j = 0; j < arb_mat_ncols(A); j++)
+        {
+            x = arb_mat_entry(A, i, j);
+
+            if (arf_is_special(arb_midref(x)))
+            {
+                if (!arf_is_zero(arb_midref(x)))
+                    return 0;
+            }
+            else if (!ARF_IS_LAGOM(arb_midref(x)))
+            {
+                return 0;
+            }
+
+            if (!mag_is_zero(arb_radref(x)) &&
+                (mag_is_inf(arb_radref(x)) || !MAG_IS_LAGOM(arb_radref(x))))
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* adds the exponents of the leading and trailing bits of x to the
+   range [*top, *bot] of a row or column; returns the new height */
+static long
+_range_add(long * top, long * bot, const arf_t x, int update)
+{
+    long t, b;
+
+    t = ARF_EXP(x);
+    b = t - arf_bits(x);
+
+    if (*top != LONG_MIN)
+    {
+        t = FLINT_MAX(t, *top);
+        b = FLINT_MIN(b, *bot);
+    }
+
+    if (update)
+    {
+        *top = t;
+        *bot = b;
+    }
+
+    return t - b;
+}
+
+/* C += A[:, start:stop] B[start:stop, :] for the midpoints, computed
+   using an exact integer matrix product */
+static void
+_arb_mat_addmul_mid_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B,
+    long start, long stop, const long * Abot, const long * Bbot, long prec)
+{
+    fmpz_mat_t AZ, BZ, CZ;
+    fmpz_t e;
+    arb_t t;
+    arf_srcptr x;
+    long i, j, k, ar, bc, len;
+
+    ar = arb_mat_nrows(A);
+    bc = arb_mat_ncols(B);
+    len = stop - start;
+
+    fmpz_mat_init(AZ, ar, len);
+    fmpz_mat_init(BZ, len, bc);
+    fmpz_mat_init(CZ, ar, bc);
+    fmpz_init(e);
+    arb_init(t);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (k = 0; k < len; k++)
+        {
+            x = arb_midref(arb_mat_entry(A, i, start + k));
+
+            if (!arf_is_zero(x))
+            {
+                arf_get_fmpz_2exp(fmpz_mat_entry(AZ, i, k), e, x);
+                fmpz_mul_2exp(fmpz_mat_entry(AZ, i, k),
+                    fmpz_mat_entry(AZ, i, k), fmpz_get_si(e) - Abot[i]);
+            }
+        }
+    }
+
+    for (k = 0; k < len; k++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            x = arb_midref(arb_mat_entry(B, start + k, j));
+
+            if (!arf_is_zero(x))
+            {
+                arf_get_fmpz_2exp(fmpz_mat_entry(BZ, k, j), e, x);
+                fmpz_mul_2exp(fmpz_mat_entry(BZ, k, j),
+                    fmpz_mat_entry(BZ, k, j), fmpz_get_si(e) - Bbot[j]);
+            }
+        }
+    }
+
+    fmpz_mat_mul(CZ, AZ, BZ);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            if (fmpz_is_zero(fmpz_mat_entry(CZ, i, j)))
+                continue;
+
+            fmpz_set_si(e, Abot[i] + Bbot[j]);
+            arb_set_round_fmpz_2exp(t, fmpz_mat_entry(CZ, i, j), e, prec);
+            arb_add(arb_mat_entry(C, i, j), arb_mat_entry(C, i, j), t, prec);
+        }
+    }
+
+    fmpz_mat_clear(AZ);
+    fmpz_mat_clear(BZ);
+    fmpz_mat_clear(CZ);
+    fmpz_clear(e);
+    arb_clear(t);
+}
+
+/* returns x / 2^e as a double, clamped as described above */
+static double
+_mag_get_d_scaled(const mag_t x, long e)
+{
+    long d;
+
+    if (mag_is_zero(x))
+        return 0.0;
+
+    d = MAG_EXP(x) - e;
+
+    if (d < -DOUBLE_SHIFT)
+        return ldexp(1.0, -DOUBLE_SHIFT);
+
+    return ldexp(MAG_MAN(x), d - MAG_BITS);
+}
+
+/* P = X Y where X is r x s and Y is s x c */
+static void
+_d_mat_mul(double * P, const double * X, const double * Y, long r, long s, long c)
+{
+    long i, j, k;
+    double x;
+
+    for (i = 0; i < r * c; i++)
+        P[i] = 0.0;
+
+    for (i = 0; i < r; i++)
+    {
+        for (k = 0; k < s; k++)
+        {
+            x = X[i * s + k];
+
+            if (x != 0.0)
+                for (j = 0; j < c; j++)
+                    P[i * c + j] += x * Y[k * c + j];
+        }
+    }
+}
+
+/* converts an r x c matrix of magnitudes to doubles, scaling each row
+   (or each column) i by 2^(-e[i]) where e[i] is its largest exponent */
+static void
+_mag_mat_get_d_scaled(double * d, long * e, mag_srcptr x, long r, long c,
+    int by_columns)
+{
+    long i, j, len, num, istride, jstride;
+
+    num = by_columns ? c : r;
+    len = by_columns ? r : c;
+    istride = by_columns ? 1 : c;
+    jstride = by_columns ? c : 1;
+
+    for (i = 0; i < num; i++)
+    {
+        e[i] = LONG_MIN;
+
+        for (j = 0; j < len; j++)
+        {
+            mag_srcptr t = x + i * istride + j * jstride;
+
+            if (!mag_is_zero(t))
+                e[i] = FLINT_MAX(e[i], MAG_EXP(t));
+        }
+
+        for (j = 0; j < len; j++)
+            d[i * istride + j * jstride] =
+                _mag_get_d_scaled(x + i * istride + j * jstride, e[i]);
+    }
+}
+
+/* adds |mid(A)| rad(B) + rad(A) (|mid(B)| + rad(B)) to the radii of C,
+   computing the matrix products using doubles */
+static void
+_arb_mat_add_rad_products(arb_mat_t C, const arb_mat_t A, const arb_mat_t B)
+{
+    mag_ptr AM, AR, BM, BR;
+    double * dAM, * dAR, * dBM, * dBR, * P;
+    long * eAM, * eAR, * eBM, * eBR;
+    long i, j, k, ar, ac, bc;
+    fmpz_t e;
+    mag_t t;
+
+    ar = arb_mat_nrows(A);
+    ac = arb_mat_ncols(A);
+    bc = arb_mat_ncols(B);
+
+    AM = _mag_vec_init(ar * ac);
+    AR = _mag_vec_init(ar * ac);
+    BM = _mag_vec_init(ac * bc);
+    BR = _mag_vec_init(ac * bc);
+
+    dAM = flint_malloc(sizeof(double) * ar * ac);
+    dAR = flint_malloc(sizeof(double) * ar * ac);
+    dBM = flint_malloc(sizeof(double) * ac * bc);
+    dBR = flint_malloc(sizeof(double) * ac * bc);
+    P = flint_malloc(sizeof(double) * ar * bc);
+
+    eAM = flint_malloc(sizeof(long) * ar);
+    eAR = flint_malloc(sizeof(long) * ar);
+    eBM = flint_malloc(sizeof(long) * bc);
+    eBR = flint_malloc(sizeof(long) * bc);
+
+    fmpz_init(e);
+    mag_init(t);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (k = 0; k < ac; k++)
+        {
+            arf_get_mag(AM + i * ac + k, arb_midref(arb_mat_entry(A, i, k)));
+            mag_set(AR + i * ac + k, arb_radref(arb_mat_entry(A, i, k)));
+        }
+    }
+
+    for (k = 0; k < ac; k++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            arf_get_mag(BM + k * bc + j, arb_midref(arb_mat_entry(B, k, j)));
+            mag_add(BM + k * bc + j, BM + k * bc + j,
+                arb_radref(arb_mat_entry(B, k, j)));
+            mag_set(BR + k * bc + j, arb_radref(arb_mat_entry(B, k, j)));
+        }
+    }
+
+    _mag_mat_get_d_scaled(dAM, eAM, AM, ar, ac, 0);
+    _mag_mat_get_d_scaled(dAR, eAR, AR, ar, ac, 0);
+    _mag_mat_get_d_scaled(dBM, eBM, BM, ac, bc, 1);
+    _mag_mat_get_d_scaled(dBR, eBR, BR, ac, bc, 1);
+
+    /* |mid(A)| rad(B) */
+    _d_mat_mul(P, dAM, dBR, ar, ac, bc);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            if (P[i * bc + j] != 0.0)
+            {
+                fmpz_set_si(e, eAM[i] + eBR[j]);
+                mag_set_d_2exp_fmpz(t, P[i * bc + j] * DOUBLE_ROUNDING_FACTOR, e);
+                mag_add(arb_radref(arb_mat_entry(C, i, j)),
+                    arb_radref(arb_mat_entry(C, i, j)), t);
+            }
+        }
+    }
+
+    /* rad(A) (|mid(B)| + rad(B)) */
+    _d_mat_mul(P, dAR, dBM, ar, ac, bc);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            if (P[i * bc + j] != 0.0)
+            {
+                fmpz_set_si(e, eAR[i] + eBM[j]);
+                mag_set_d_2exp_fmpz(t, P[i * bc + j] * DOUBLE_ROUNDING_FACTOR, e);
+                mag_add(arb_radref(arb_mat_entry(C, i, j)),
+                    arb_radref(arb_mat_entry(C, i, j)), t);
+            }
+        }
+    }
+
+    _mag_vec_clear(AM, ar * ac);
+    _mag_vec_clear(AR, ar * ac);
+    _mag_vec_clear(BM, ac * bc);
+    _mag_vec_clear(BR, ac * bc);
+
+    flint_free(dAM);
+    flint_free(dAR);
+    flint_free(dBM);
+    flint_free(dBR);
+    flint_free(P);
+
+    flint_free(eAM);
+    flint_free(eAR);
+    flint_free(eBM);
+    flint_free(eBR);
+
+    fmpz_clear(e);
+    mag_clear(t);
+}
+
+void
+arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, long prec)
+{
+    long ar, ac, br, bc, i, j, start, stop, maxheight;
+    long * Atop, * Abot, * Btop, * Bbot;
+    int ok;
+
+    ar = arb_mat_nrows(A);
+    ac = arb_mat_ncols(A);
+    br = arb_mat_nrows(B);
+    bc = arb_mat_ncols(B);
+
+    if (ac != br || ar != arb_mat_nrows(C) || bc != arb_mat_ncols(C))
+    {
+        printf("arb_mat_mul_block: incompatible dimensions\n");
+        abort();
+    }
+
+    if (br == 0)
+    {
+        arb_mat_zero(C);
+        return;
+    }
+
+    if (ac > DOUBLE_MAX_LENGTH || !_arb_mat_is_lagom(A) || !_arb_mat_is_lagom(B))
+    {
+        arb_mat_mul_classical(C, A, B, prec);
+        return;
+    }
+
+    if (A == C || B == C)
+    {
+        arb_mat_t T;
+        arb_mat_init(T, ar, bc);
+        arb_mat_mul_block(T, A, B, prec);
+        arb_mat_swap_entrywise(T, C);
+        arb_mat_clear(T);
+        return;
+    }
+
+    maxheight = ALPHA * prec + BETA;
+
+    Atop = flint_malloc(sizeof(long) * ar);
+    Abot = flint_malloc(sizeof(long) * ar);
+    Btop = flint_malloc(sizeof(long) * bc);
+    Bbot = flint_malloc(sizeof(long) * bc);
+
+    arb_mat_zero(C);
+
+    start = 0;
+
+    while (start < ac)
+    {
+        for (i = 0; i < ar; i++)
+            Atop[i] = Abot[i] = LONG_MIN;
+        for (j = 0; j < bc; j++)
+            Btop[j] = Bbot[j] = LONG_MIN;
+
+        /* extend the block while the heights stay bounded; the first
+           index is always included */
+        for (stop = start; stop < ac; stop++)
+        {
+            ok = 1;
+
+            if (stop > start)
+            {
+                for (i = 0; i < ar && ok; i++)
+                    if (!arf_is_zero(arb_midref(arb_mat_entry(A, i, stop))))
+                        ok = _range_add(Atop + i, Abot + i,
+                            arb_midref(arb_mat_entry(A, i, stop)), 0) <= maxheight;
+
+                for (j = 0; j < bc && ok; j++)
+                    if (!arf_is_zero(arb_midref(arb_mat_entry(B, stop, j))))
+                        ok = _range_add(Btop + j, Bbot + j,
+                            arb_midref(arb_mat_entry(B, stop, j)), 0) <= maxheight;
+            }
+
+            if (!ok)
+                break;
+
+            for (i = 0; i < ar; i++)
+                if (!arf_is_zero(arb_midref(arb_mat_entry(A, i, stop))))
+                    _range_add(Atop + i, Abot + i,
+                        arb_midref(arb_mat_entry(A, i, stop)), 1);
+
+            for (j = 0; j < bc; j++)
+                if (!arf_is_zero(arb_midref(arb_mat_entry(B, stop, j))))
+                    _range_add(Btop + j, Bbot + j,
+                        arb_midref(arb_mat_entry(B, stop, j)), 1);
+        }
+
+        _arb_mat_addmul_mid_block(C, A, B, start, stop, Abot, Bbot, prec);
+
+        start = stop;
+    }
+
+    flint_free(Atop);
+    flint_free(Abot);
+    flint_free(Btop);
+    flint_free(Bbot);
+
+    _arb_mat_add_rad_products(C, A, B);
+}
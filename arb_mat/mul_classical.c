@@ -52,7 +52,7 @@ arb_mat_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, long pr
         arb_mat_t T;
         arb_mat_init(T, ar, bc);
         arb_mat_mul(T, A, B, prec);
-        arb_mat_swap(T, C);
+        arb_mat_swap_entrywise(T, C);
         arb_mat_clear(T);
         return;
     }
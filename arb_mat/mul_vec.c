@@ -0,0 +1,67 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_mat.h"
+
+void
+_arb_mat_mul_vec(arb_ptr res, const arb_mat_t A, arb_srcptr v, long prec)
+{
+    long i, j, r, c;
+
+    r = arb_mat_nrows(A);
+    c = arb_mat_ncols(A);
+
+    if (c == 0)
+    {
+        _arb_vec_zero(res, r);
+        return;
+    }
+
+    for (i = 0; i < r; i++)
+    {
+        arb_mul(res + i, arb_mat_entry(A, i, 0), v, prec);
+
+        for (j = 1; j < c; j++)
+            arb_addmul(res + i, arb_mat_entry(A, i, j), v + j, prec);
+    }
+}
+
+void
+arb_mat_mul_vec(arb_ptr res, const arb_mat_t A, arb_srcptr v, long prec)
+{
+    long r = arb_mat_nrows(A);
+
+    if (res == v)
+    {
+        arb_ptr t = _arb_vec_init(r);
+        _arb_mat_mul_vec(t, A, v, prec);
+        _arb_vec_swap(res, t, r);
+        _arb_vec_clear(t, r);
+    }
+    else
+    {
+        _arb_mat_mul_vec(res, A, v, prec);
+    }
+}
@@ -47,29 +47,49 @@ arb_mat_pow_ui(arb_mat_t B, const arb_mat_t A, ulong exp, long prec)
         }
         else if (exp == 2)
         {
-            arb_mat_mul(B, A, A, prec);   /* todo: sqr */
+            arb_mat_sqr(B, A, prec);
         }
     }
     else
     {
         arb_mat_t T, U;
-        long i;
+        long i, j, k;
+        int sym;
 
         arb_mat_init(T, d, d);
         arb_mat_set(T, A);
         arb_mat_init(U, d, d);
 
+        /*
+        If A is symmetric, so is every power. The product U A is not
+        computed symmetrically, so we restore symmetry by copying the upper
+        triangle; this is valid since A contains the transpose of every
+        point matrix it contains. Keeping T symmetric lets arb_mat_sqr
+        halve the work.
+        */
+        sym = arb_mat_is_symmetric(A);
+
         for (i = ((long) FLINT_BIT_COUNT(exp)) - 2; i >= 0; i--)
         {
-            arb_mat_mul(U, T, T, prec);   /* todo: sqr */
+            arb_mat_sqr(U, T, prec);
 
             if (exp & (1L << i))
+            {
                 arb_mat_mul(T, U, A, prec);
+
+                if (sym)
+                    for (j = 0; j < d; j++)
+                        for (k = j + 1; k < d; k++)
+                            arb_set(arb_mat_entry(T, k, j),
+                                arb_mat_entry(T, j, k));
+            }
             else
+            {
                 arb_mat_swap(T, U);
+            }
         }
 
-        arb_mat_swap(B, T);
+        arb_mat_swap_entrywise(B, T);
         arb_mat_clear(T);
         arb_mat_clear(U);
     }
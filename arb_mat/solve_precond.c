@@ -0,0 +1,247 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_mat.h"
+
+/* sets B to the midpoint matrix of A */
+static void
+_arb_mat_get_mid(arb_mat_t B, const arb_mat_t A)
+{
+    long i, j;
+
+    for (i = 0; i < arb_mat_nrows(A); i++)
+    {
+        for (j = 0; j < arb_mat_ncols(A); j++)
+        {
+            arf_set(arb_midref(arb_mat_entry(B, i, j)),
+                arb_midref(arb_mat_entry(A, i, j)));
+            mag_zero(arb_radref(arb_mat_entry(B, i, j)));
+        }
+    }
+}
+
+/*
+Sets R to an approximate inverse of the midpoint matrix of A, computed
+by Gauss-Jordan elimination with partial pivoting in floating-point
+arithmetic (no error propagation). The entries of R are exact.
+Returns zero if an exactly zero pivot is encountered.
+*/
+static int
+_arb_mat_approx_inv(arb_mat_t R, const arb_mat_t A, long prec)
+{
+    arb_mat_t M;
+    arf_t t, e;
+    arf_ptr * a, * r;
+    long i, j, k, n, piv;
+    int result;
+
+    n = arb_mat_nrows(A);
+
+    arb_mat_init(M, n, n);
+    _arb_mat_get_mid(M, A);
+    arb_mat_one(R);
+
+    arf_init(t);
+    arf_init(e);
+
+    a = flint_malloc(sizeof(arf_ptr) * n);
+    r = flint_malloc(sizeof(arf_ptr) * n);
+
+    result = 1;
+
+    for (k = 0; k < n && result; k++)
+    {
+        piv = -1;
+        for (i = k; i < n; i++)
+        {
+            if (!arf_is_zero(arb_midref(arb_mat_entry(M, i, k))) &&
+                (piv == -1 || arf_cmpabs(arb_midref(arb_mat_entry(M, i, k)),
+                    arb_midref(arb_mat_entry(M, piv, k))) > 0))
+                piv = i;
+        }
+
+        if (piv == -1)
+        {
+            result = 0;
+            break;
+        }
+
+        arb_mat_swap_rows(M, NULL, k, piv);
+        arb_mat_swap_rows(R, NULL, k, piv);
+
+        for (j = 0; j < n; j++)
+        {
+            a[j] = arb_midref(arb_mat_entry(M, k, j));
+            r[j] = arb_midref(arb_mat_entry(R, k, j));
+        }
+
+        /* scale the pivot row */
+        arf_set(t, a[k]);
+        for (j = 0; j < n; j++)
+        {
+            arf_div(a[j], a[j], t, prec, ARF_RND_DOWN);
+            arf_div(r[j], r[j], t, prec, ARF_RND_DOWN);
+        }
+
+        /* eliminate the other rows */
+        for (i = 0; i < n; i++)
+        {
+            if (i == k)
+                continue;
+
+            arf_set(e, arb_midref(arb_mat_entry(M, i, k)));
+
+            if (arf_is_zero(e))
+                continue;
+
+            for (j = 0; j < n; j++)
+            {
+                arf_submul(arb_midref(arb_mat_entry(M, i, j)), e, a[j],
+                    prec, ARF_RND_DOWN);
+                arf_submul(arb_midref(arb_mat_entry(R, i, j)), e, r[j],
+                    prec, ARF_RND_DOWN);
+            }
+        }
+    }
+
+    flint_free(a);
+    flint_free(r);
+    arf_clear(t);
+    arf_clear(e);
+    arb_mat_clear(M);
+
+    return result;
+}
+
+int
+arb_mat_solve_precond(arb_mat_t X, const arb_mat_t A, const arb_mat_t B, long prec)
+{
+    arb_mat_t R, C, Z, Xm, T;
+    mag_t d, z, zmax;
+    arf_t u;
+    long i, j, n, m;
+    int result;
+
+    n = arb_mat_nrows(A);
+    m = arb_mat_ncols(X);
+
+    if (n != arb_mat_ncols(A) || n != arb_mat_nrows(B) ||
+        n != arb_mat_nrows(X) || m != arb_mat_ncols(B))
+    {
+        printf("arb_mat_solve_precond: incompatible dimensions\n");
+        abort();
+    }
+
+    if (n == 0 || m == 0)
+        return 1;
+
+    arb_mat_init(R, n, n);
+
+    if (!_arb_mat_approx_inv(R, A, prec))
+    {
+        arb_mat_clear(R);
+        return 0;
+    }
+
+    arb_mat_init(C, n, n);
+    arb_mat_init(Z, n, m);
+    arb_mat_init(Xm, n, m);
+    arb_mat_init(T, n, m);
+    mag_init(d);
+    mag_init(z);
+    mag_init(zmax);
+    arf_init(u);
+
+    /* approximate solution Xm = mid(R mid(B)) */
+    _arb_mat_get_mid(T, B);
+    arb_mat_mul(Xm, R, T, prec);
+    _arb_mat_get_mid(Xm, Xm);
+
+    /* C = I - R A */
+    arb_mat_mul(C, R, A, prec);
+    arb_mat_neg(C, C);
+    for (i = 0; i < n; i++)
+        arb_add_ui(arb_mat_entry(C, i, i), arb_mat_entry(C, i, i), 1, prec);
+
+    arb_mat_bound_inf_norm(d, C);
+
+    /* u = lower bound for 1 - ||C|| */
+    arf_set_mag(u, d);
+    arf_sub_ui(u, u, 1, MAG_BITS, ARF_RND_UP);
+    arf_neg(u, u);
+
+    result = (arf_sgn(u) > 0);
+
+    if (result)
+    {
+        /* Z = R (B - A Xm), enclosing the first correction */
+        arb_mat_mul(T, A, Xm, prec);
+        arb_mat_sub(T, B, T, prec);
+        arb_mat_mul(Z, R, T, prec);
+
+        /*
+        Every solution satisfies X - Xm = Z' + C' (X - Xm) for some Z' in Z
+        and C' in C, so the entries of column j of X - Xm are bounded by
+        e_j = max_i |Z_ij| / (1 - ||C||). Then X lies in Xm + Z + C E where
+        E has entries [+/- e_j], which is much tighter than Xm + E.
+        */
+        arf_get_mag_lower(d, u);
+
+        for (j = 0; j < m; j++)
+        {
+            mag_zero(zmax);
+            for (i = 0; i < n; i++)
+            {
+                arb_get_mag(z, arb_mat_entry(Z, i, j));
+                mag_max(zmax, zmax, z);
+            }
+
+            mag_div(zmax, zmax, d);
+
+            for (i = 0; i < n; i++)
+            {
+                arb_zero(arb_mat_entry(T, i, j));
+                mag_set(arb_radref(arb_mat_entry(T, i, j)), zmax);
+            }
+        }
+
+        arb_mat_mul(X, C, T, prec);
+        arb_mat_add(X, X, Z, prec);
+        arb_mat_add(X, X, Xm, prec);
+    }
+
+    arb_mat_clear(R);
+    arb_mat_clear(C);
+    arb_mat_clear(Z);
+    arb_mat_clear(Xm);
+    arb_mat_clear(T);
+    mag_clear(d);
+    mag_clear(z);
+    mag_clear(zmax);
+    arf_clear(u);
+
+    return result;
+}
+
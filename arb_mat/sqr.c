@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_mat.h"
+
+void
+arb_mat_sqr(arb_mat_t B, const arb_mat_t A, long prec)
+{
+    long n, i, j, k;
+
+    n = arb_mat_nrows(A);
+
+    if (arb_mat_ncols(A) != n || arb_mat_nrows(B) != n ||
+        arb_mat_ncols(B) != n)
+    {
+        printf("arb_mat_sqr: incompatible dimensions\n");
+        abort();
+    }
+
+    if (n == 0)
+        return;
+
+    if (n == 1)
+    {
+        arb_mul(arb_mat_entry(B, 0, 0),
+            arb_mat_entry(A, 0, 0), arb_mat_entry(A, 0, 0), prec);
+        return;
+    }
+
+    /* the threaded product wins over halving the work */
+    if (!arb_mat_is_symmetric(A) || (flint_get_num_threads() > 1 &&
+        (double) n * (double) n * (double) n * (double) prec > 100000))
+    {
+        arb_mat_mul(B, A, A, prec);
+        return;
+    }
+
+    if (A == B)
+    {
+        arb_mat_t T;
+        arb_mat_init(T, n, n);
+        arb_mat_sqr(T, A, prec);
+        arb_mat_swap_entrywise(T, B);
+        arb_mat_clear(T);
+        return;
+    }
+
+    /*
+    The square of a symmetric matrix is symmetric, and its entry (i, j)
+    is the dot product of rows i and j, so only the upper triangle
+    needs to be computed. This is also valid for ball matrices: if A'
+    is a point matrix contained in A, then so is its transpose.
+    */
+    for (i = 0; i < n; i++)
+    {
+        for (j = i; j < n; j++)
+        {
+            arb_mul(arb_mat_entry(B, i, j),
+                      arb_mat_entry(A, i, 0),
+                      arb_mat_entry(A, j, 0), prec);
+
+            for (k = 1; k < n; k++)
+            {
+                arb_addmul(arb_mat_entry(B, i, j),
+                             arb_mat_entry(A, i, k),
+                             arb_mat_entry(A, j, k), prec);
+            }
+
+            if (j != i)
+                arb_set(arb_mat_entry(B, j, i), arb_mat_entry(B, i, j));
+        }
+    }
+}
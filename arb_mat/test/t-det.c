@@ -81,6 +81,55 @@ int main()
         arb_clear(Adet);
     }
 
+    /* exact integer input gives the correctly rounded determinant */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        fmpz_mat_t Z;
+        fmpz_t Zdet;
+        arb_mat_t A;
+        arb_t Adet, D;
+        long n, zbits, prec;
+
+        n = n_randint(state, 12);
+        zbits = 1 + n_randint(state, 100);
+        prec = 2 + n_randint(state, 200);
+
+        fmpz_mat_init(Z, n, n);
+        fmpz_init(Zdet);
+
+        arb_mat_init(A, n, n);
+        arb_init(Adet);
+        arb_init(D);
+
+        fmpz_mat_randtest(Z, state, zbits);
+        fmpz_mat_det(Zdet, Z);
+
+        arb_mat_set_fmpz_mat(A, Z);
+        arb_mat_det(Adet, A, prec);
+
+        arb_set_round_fmpz(D, Zdet, prec);
+
+        if (!arb_contains_fmpz(Adet, Zdet) ||
+            (n > 2 && 2 * prec + 64 >= zbits && !arb_equal(Adet, D)))
+        {
+            printf("FAIL (exact, iter = %ld)\n", iter);
+            printf("n = %ld, prec = %ld\n", n, prec);
+            printf("\n");
+
+            printf("Z = \n"); fmpz_mat_print_pretty(Z); printf("\n\n");
+            printf("Zdet = \n"); fmpz_print(Zdet); printf("\n\n");
+            printf("Adet = \n"); arb_print(Adet); printf("\n\n");
+
+            abort();
+        }
+
+        fmpz_mat_clear(Z);
+        fmpz_clear(Zdet);
+        arb_mat_clear(A);
+        arb_clear(Adet);
+        arb_clear(D);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     printf("PASS\n");
@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_mat.h"
+
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("mul_batch....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        long m, k, n, num, l, i, j, rbits1, rbits2;
+        arb_mat_t a, b, c;
+        arb_ptr A, B, C;
+
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+
+        m = n_randint(state, 8);
+        k = n_randint(state, 8);
+        n = n_randint(state, 8);
+        num = n_randint(state, 20);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        A = _arb_vec_init(num * m * k);
+        B = _arb_vec_init(num * k * n);
+        C = _arb_vec_init(num * m * n);
+
+        arb_mat_init(a, m, k);
+        arb_mat_init(b, k, n);
+        arb_mat_init(c, m, n);
+
+        for (l = 0; l < num * m * k; l++)
+            arb_randtest(A + l, state, rbits1, 10);
+        for (l = 0; l < num * k * n; l++)
+            arb_randtest(B + l, state, rbits1, 10);
+
+        _arb_mat_mul_batch(C, A, B, m, k, n, num, rbits2);
+
+        for (l = 0; l < num; l++)
+        {
+            for (i = 0; i < m; i++)
+                for (j = 0; j < k; j++)
+                    arb_set(arb_mat_entry(a, i, j), A + l * m * k + i * k + j);
+            for (i = 0; i < k; i++)
+                for (j = 0; j < n; j++)
+                    arb_set(arb_mat_entry(b, i, j), B + l * k * n + i * n + j);
+
+            arb_mat_mul(c, a, b, rbits2);
+
+            for (i = 0; i < m; i++)
+            {
+                for (j = 0; j < n; j++)
+                {
+                    if (!arb_equal(arb_mat_entry(c, i, j),
+                        C + l * m * n + i * n + j))
+                    {
+                        printf("FAIL\n\n");
+                        printf("m = %ld, k = %ld, n = %ld, l = %ld\n", m, k, n, l);
+                        printf("a = "); arb_mat_printd(a, 15); printf("\n\n");
+                        printf("b = "); arb_mat_printd(b, 15); printf("\n\n");
+                        printf("c = "); arb_mat_printd(c, 15); printf("\n\n");
+                        abort();
+                    }
+                }
+            }
+        }
+
+        _arb_vec_clear(A, num * m * k);
+        _arb_vec_clear(B, num * k * n);
+        _arb_vec_clear(C, num * m * n);
+
+        arb_mat_clear(a);
+        arb_mat_clear(b);
+        arb_mat_clear(c);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -265,6 +265,14 @@ void _arb_poly_rem(arb_ptr R,
     arb_srcptr A, long lenA,
     arb_srcptr B, long lenB, long prec);
 
+void _arb_poly_divrem_preinv(arb_ptr Q, arb_ptr R,
+    arb_srcptr A, long lenA, arb_srcptr B, long lenB,
+    arb_srcptr Binv, long lenBinv, long prec);
+
+void _arb_poly_rem_preinv(arb_ptr R,
+    arb_srcptr A, long lenA, arb_srcptr B, long lenB,
+    arb_srcptr Binv, long lenBinv, long prec);
+
 void arb_poly_divrem(arb_poly_t Q, arb_poly_t R,
                              const arb_poly_t A, const arb_poly_t B, long prec);
 
@@ -277,12 +285,23 @@ void _arb_poly_product_roots(arb_ptr poly, arb_srcptr xs, long n, long prec);
 
 void arb_poly_product_roots(arb_poly_t poly, arb_srcptr xs, long n, long prec);
 
+/* minimum value of (number of blocks) * (block length) * prec for
+   splitting one level of a product tree over several threads */
+#define ARB_POLY_TREE_THREAD_CUTOFF 100000
+
 arb_ptr * _arb_poly_tree_alloc(long len);
 
 void _arb_poly_tree_free(arb_ptr * tree, long len);
 
 void _arb_poly_tree_build(arb_ptr * tree, arb_srcptr roots, long len, long prec);
 
+arb_ptr * _arb_poly_tree_inv_alloc(long len);
+
+void _arb_poly_tree_inv_free(arb_ptr * tree_inv, long len);
+
+void _arb_poly_tree_inv_build(arb_ptr * tree_inv, arb_ptr * tree,
+    long len, long prec);
+
 /* Composition */
 
 void _arb_poly_compose(arb_ptr res,
@@ -366,6 +385,9 @@ void arb_poly_evaluate_vec_iter(arb_ptr ys,
 void _arb_poly_evaluate_vec_fast_precomp(arb_ptr vs, arb_srcptr poly,
     long plen, arb_ptr * tree, long len, long prec);
 
+void _arb_poly_evaluate_vec_fast_precomp_preinv(arb_ptr vs, arb_srcptr poly,
+    long plen, arb_ptr * tree, arb_ptr * tree_inv, long len, long prec);
+
 void _arb_poly_evaluate_vec_fast(arb_ptr ys, arb_srcptr poly, long plen,
     arb_srcptr xs, long n, long prec);
 
@@ -398,6 +420,31 @@ void _arb_poly_interpolate_fast(arb_ptr poly,
 void arb_poly_interpolate_fast(arb_poly_t poly,
         arb_srcptr xs, arb_srcptr ys, long n, long prec);
 
+/* Precomputed data for multipoint evaluation and interpolation */
+
+typedef struct
+{
+    arb_ptr * tree;
+    arb_ptr * tree_inv;
+    arb_ptr weights;
+    long len;
+    long prec;
+}
+arb_poly_multipoint_struct;
+
+typedef arb_poly_multipoint_struct arb_poly_multipoint_t[1];
+
+void arb_poly_multipoint_init(arb_poly_multipoint_t M,
+    arb_srcptr xs, long n, long prec);
+
+void arb_poly_multipoint_clear(arb_poly_multipoint_t M);
+
+void arb_poly_multipoint_evaluate(arb_ptr ys, const arb_poly_multipoint_t M,
+    const arb_poly_t poly, long prec);
+
+void arb_poly_multipoint_interpolate(arb_poly_t poly,
+    const arb_poly_multipoint_t M, arb_srcptr ys, long prec);
+
 /* Derivative and integral */
 
 void _arb_poly_derivative(arb_ptr res, arb_srcptr poly, long len, long prec);
@@ -430,6 +477,18 @@ void _arb_poly_binomial_transform(arb_ptr b, arb_srcptr a, long alen, long len,
 
 void arb_poly_binomial_transform(arb_poly_t b, const arb_poly_t a, long len, long prec);
 
+void _arb_poly_taylor_shift_horner(arb_ptr poly, const arb_t c, long n, long prec);
+
+void arb_poly_taylor_shift_horner(arb_poly_t g, const arb_poly_t f, const arb_t c, long prec);
+
+void _arb_poly_taylor_shift_convolution(arb_ptr poly, const arb_t c, long n, long prec);
+
+void arb_poly_taylor_shift_convolution(arb_poly_t g, const arb_poly_t f, const arb_t c, long prec);
+
+void _arb_poly_taylor_shift(arb_ptr poly, const arb_t c, long n, long prec);
+
+void arb_poly_taylor_shift(arb_poly_t g, const arb_poly_t f, const arb_t c, long prec);
+
 /* Special functions */
 
 void _arb_poly_pow_ui_trunc_binexp(arb_ptr res,
@@ -567,6 +626,8 @@ void arb_poly_riemann_siegel_theta_series(arb_poly_t res, const arb_poly_t h, lo
 void _arb_poly_riemann_siegel_z_series(arb_ptr res, arb_srcptr h, long hlen, long len, long prec);
 void arb_poly_riemann_siegel_z_series(arb_poly_t res, const arb_poly_t h, long n, long prec);
 
+void _arb_poly_riemann_siegel_z_grid(arb_ptr res, const arb_t t0, const arb_t delta, long num, long len, long prec);
+
 /* Root-finding */
 
 void _arb_poly_newton_convergence_factor(arf_t convergence_factor,
@@ -585,6 +646,12 @@ void _arb_poly_newton_refine_root(arb_t r, arb_srcptr poly,
     long eval_extra_prec,
     long prec);
 
+long _arb_poly_isolate_real_roots(arb_ptr * roots, int ** flags,
+    arb_srcptr poly, long len, long maxdepth, long prec);
+
+long arb_poly_isolate_real_roots(arb_ptr * roots, int ** flags,
+    const arb_poly_t poly, long maxdepth, long prec);
+
 /* Macros */
 
 
@@ -26,6 +26,8 @@
 #include "arb_poly.h"
 #include "arb_mat.h"
 
+#define ARB_POLY_COMPOSE_BLOCK_CUTOFF 8
+
 void
 _arb_poly_compose_series_brent_kung(arb_ptr res,
     arb_srcptr poly1, long len1,
@@ -61,7 +63,12 @@ _arb_poly_compose_series_brent_kung(arb_ptr res,
     for (i = 2; i < m; i++)
         _arb_poly_mullow(A->rows[i], A->rows[(i + 1) / 2], n, A->rows[i / 2], n, n, prec);
 
-    arb_mat_mul(C, B, A, prec);
+    /* the powers of poly2 typically have smoothly varying magnitudes,
+       which the block algorithm handles with few blocks */
+    if (m >= ARB_POLY_COMPOSE_BLOCK_CUTOFF)
+        arb_mat_mul_block(C, B, A, prec);
+    else
+        arb_mat_mul(C, B, A, prec);
 
     /* Evaluate block composition using the Horner scheme */
     _arb_vec_set(res, C->rows[m - 1], n);
@@ -23,32 +23,171 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arb_poly.h"
 
-/* This gives some speedup for small lengths. */
+/* Remainder modulo b, using the inverse binv of the reversal of b
+   to length pow if it has been precomputed and is long enough.
+   The special case gives some speedup for small lengths. */
 static __inline__ void
 _arb_poly_rem_2(arb_ptr r, arb_srcptr a, long al,
-    arb_srcptr b, long bl, long prec)
+    arb_srcptr b, long bl, arb_srcptr binv, long pow, long prec)
 {
     if (al == 2)
     {
         arb_mul(r + 0, a + 1, b + 0, prec);
         arb_sub(r + 0, a + 0, r + 0, prec);
     }
+    else if (binv != NULL && al - bl + 1 <= pow)
+    {
+        _arb_poly_rem_preinv(r, a, al, b, bl, binv, pow, prec);
+    }
     else
     {
         _arb_poly_rem(r, a, al, b, bl, prec);
     }
 }
 
+/*
+Reduces blocks start, ..., stop - 1 of one level: block j reduces
+pb + 2 pow j modulo the two children pa + (2 pow + 2) j and
+pa + (2 pow + 2) j + pow + 1, writing the results to pc + 2 pow j.
+If pi is not NULL, the inverses of the reversed children are read
+from pi + 2 pow j and pi + 2 pow j + pow.
+The possible incomplete last block is handled separately.
+*/
+static void
+_arb_poly_evaluate_vec_fast_blocks(arb_ptr pc, arb_srcptr pb, arb_srcptr pa,
+    arb_srcptr pi, long pow, long start, long stop, long prec)
+{
+    long j;
+
+    for (j = start; j < stop; j++)
+    {
+        _arb_poly_rem_2(pc + 2 * pow * j, pb + 2 * pow * j, 2 * pow,
+            pa + (2 * pow + 2) * j, pow + 1,
+            pi == NULL ? NULL : pi + 2 * pow * j, pow, prec);
+        _arb_poly_rem_2(pc + 2 * pow * j + pow, pb + 2 * pow * j, 2 * pow,
+            pa + (2 * pow + 2) * j + pow + 1, pow + 1,
+            pi == NULL ? NULL : pi + 2 * pow * j + pow, pow, prec);
+    }
+}
+
+/* initial reduction of poly modulo the polynomials j = start, ..., stop - 1
+   of the level with pow roots per polynomial */
+static void
+_arb_poly_evaluate_vec_fast_initial(arb_ptr t, arb_srcptr poly, long plen,
+    arb_srcptr pa, arb_srcptr pi, long pow, long len, long start, long stop,
+    long prec)
+{
+    long j, tlen;
+
+    for (j = start; j < stop; j++)
+    {
+        tlen = FLINT_MIN(pow, len - j * pow);
+
+        if (pi != NULL && plen - tlen <= pow)
+            _arb_poly_rem_preinv(t + j * pow, poly, plen,
+                pa + j * (pow + 1), tlen + 1, pi + j * pow, pow, prec);
+        else
+            _arb_poly_rem(t + j * pow, poly, plen,
+                pa + j * (pow + 1), tlen + 1, prec);
+    }
+}
+
+typedef struct
+{
+    arb_ptr pc;
+    arb_srcptr pb;
+    arb_srcptr pa;
+    arb_srcptr pi;
+    arb_srcptr poly;
+    long plen;
+    long len;
+    long pow;
+    long start;
+    long stop;
+    int initial;
+    long prec;
+}
+evaluate_vec_fast_arg_t;
+
+static void *
+_arb_poly_evaluate_vec_fast_worker(void * arg_ptr)
+{
+    evaluate_vec_fast_arg_t arg = *((evaluate_vec_fast_arg_t *) arg_ptr);
+
+    if (arg.initial)
+        _arb_poly_evaluate_vec_fast_initial(arg.pc, arg.poly, arg.plen,
+            arg.pa, arg.pi, arg.pow, arg.len, arg.start, arg.stop, arg.prec);
+    else
+        _arb_poly_evaluate_vec_fast_blocks(arg.pc, arg.pb, arg.pa,
+            arg.pi, arg.pow, arg.start, arg.stop, arg.prec);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* the blocks of a level are independent and can be split over threads */
+static void
+_arb_poly_evaluate_vec_fast_level(arb_ptr pc, arb_srcptr pb, arb_srcptr pa,
+    arb_srcptr pi, arb_srcptr poly, long plen, long len, long pow, long num, int initial,
+    long prec)
+{
+    long i, num_threads;
+    double work;
+    pthread_t * threads;
+    evaluate_vec_fast_arg_t * args;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+    work = (double) num * (initial ? plen : pow) * prec;
+
+    if (num_threads <= 1 || work < ARB_POLY_TREE_THREAD_CUTOFF)
+    {
+        if (initial)
+            _arb_poly_evaluate_vec_fast_initial(pc, poly, plen,
+                pa, pi, pow, len, 0, num, prec);
+        else
+            _arb_poly_evaluate_vec_fast_blocks(pc, pb, pa, pi,
+                pow, 0, num, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(evaluate_vec_fast_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].pc = pc;
+        args[i].pb = pb;
+        args[i].pa = pa;
+        args[i].pi = pi;
+        args[i].poly = poly;
+        args[i].plen = plen;
+        args[i].len = len;
+        args[i].pow = pow;
+        args[i].start = (num * i) / num_threads;
+        args[i].stop = (num * (i + 1)) / num_threads;
+        args[i].initial = initial;
+        args[i].prec = prec;
+        pthread_create(&threads[i], NULL,
+            _arb_poly_evaluate_vec_fast_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
-_arb_poly_evaluate_vec_fast_precomp(arb_ptr vs, arb_srcptr poly,
-    long plen, arb_ptr * tree, long len, long prec)
+_arb_poly_evaluate_vec_fast_precomp_preinv(arb_ptr vs, arb_srcptr poly,
+    long plen, arb_ptr * tree, arb_ptr * tree_inv, long len, long prec)
 {
-    long height, i, j, pow, left;
+    long height, i, pow, left, num;
     long tree_height;
-    long tlen;
-    arb_ptr t, u, swap, pa, pb, pc;
+    arb_ptr t, u, swap, pa, pb, pc, pi;
 
     /* avoid worrying about some degenerate cases */
     if (len < 2 || plen < 2)
@@ -86,35 +225,31 @@ _arb_poly_evaluate_vec_fast_precomp(arb_ptr vs, arb_srcptr poly,
         height--;
     pow = 1L << height;
 
-    for (i = j = 0; i < len; i += pow, j += (pow + 1))
-    {
-        tlen = ((i + pow) <= len) ? pow : len % pow;
-        _arb_poly_rem(t + i, poly, plen, tree[height] + j, tlen + 1, prec);
-    }
+    _arb_poly_evaluate_vec_fast_level(t, NULL, tree[height],
+        tree_inv == NULL ? NULL : tree_inv[height], poly, plen,
+        len, pow, (len + pow - 1) / pow, 1, prec);
 
     for (i = height - 1; i >= 0; i--)
     {
         pow = 1L << i;
-        left = len;
-        pa = tree[i];
-        pb = t;
-        pc = u;
+        num = len / (2 * pow);
+        left = len - num * 2 * pow;
 
-        while (left >= 2 * pow)
-        {
-            _arb_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, prec);
-            _arb_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, prec);
+        pi = (tree_inv == NULL) ? NULL : tree_inv[i];
 
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-            pc += 2 * pow;
-            left -= 2 * pow;
-        }
+        _arb_poly_evaluate_vec_fast_level(u, t, tree[i], pi, NULL, 0,
+            len, pow, num, 0, prec);
+
+        pa = tree[i] + num * (2 * pow + 2);
+        pb = t + num * 2 * pow;
+        pc = u + num * 2 * pow;
 
         if (left > pow)
         {
-            _arb_poly_rem(pc, pb, left, pa, pow + 1, prec);
-            _arb_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, prec);
+            _arb_poly_rem_2(pc, pb, left, pa, pow + 1,
+                pi == NULL ? NULL : pi + num * 2 * pow, pow, prec);
+            _arb_poly_rem_2(pc + pow, pb, left, pa + pow + 1, left - pow + 1,
+                pi == NULL ? NULL : pi + num * 2 * pow + pow, pow, prec);
         }
         else if (left > 0)
             _arb_vec_set(pc, pb, left);
@@ -129,6 +264,14 @@ _arb_poly_evaluate_vec_fast_precomp(arb_ptr vs, arb_srcptr poly,
     _arb_vec_clear(u, len);
 }
 
+void
+_arb_poly_evaluate_vec_fast_precomp(arb_ptr vs, arb_srcptr poly,
+    long plen, arb_ptr * tree, long len, long prec)
+{
+    _arb_poly_evaluate_vec_fast_precomp_preinv(vs, poly, plen,
+        tree, NULL, len, prec);
+}
+
 void _arb_poly_evaluate_vec_fast(arb_ptr ys, arb_srcptr poly, long plen,
     arb_srcptr xs, long n, long prec)
 {
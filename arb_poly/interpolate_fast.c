@@ -23,6 +23,7 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arb_poly.h"
 
 void
@@ -57,13 +58,104 @@ _arb_poly_interpolation_weights(arb_ptr w,
     _arb_vec_clear(tmp, len + 1);
 }
 
+/* combines blocks start, ..., stop - 1 of one level in place, using
+   scratch space t, u of length 2 pow */
+static void
+_arb_poly_interpolate_fast_blocks(arb_ptr pb, arb_srcptr pa, long pow,
+    long start, long stop, arb_ptr t, arb_ptr u, long prec)
+{
+    long j;
+    arb_srcptr a;
+    arb_ptr b;
+
+    for (j = start; j < stop; j++)
+    {
+        a = pa + (2 * pow + 2) * j;
+        b = pb + 2 * pow * j;
+
+        _arb_poly_mul(t, a, pow + 1, b + pow, pow, prec);
+        _arb_poly_mul(u, a + pow + 1, pow + 1, b, pow, prec);
+        _arb_vec_add(b, t, u, 2 * pow, prec);
+    }
+}
+
+typedef struct
+{
+    arb_ptr pb;
+    arb_srcptr pa;
+    long pow;
+    long start;
+    long stop;
+    long prec;
+}
+interpolate_fast_arg_t;
+
+static void *
+_arb_poly_interpolate_fast_worker(void * arg_ptr)
+{
+    interpolate_fast_arg_t arg = *((interpolate_fast_arg_t *) arg_ptr);
+    arb_ptr t, u;
+
+    t = _arb_vec_init(2 * arg.pow);
+    u = _arb_vec_init(2 * arg.pow);
+
+    _arb_poly_interpolate_fast_blocks(arg.pb, arg.pa, arg.pow,
+        arg.start, arg.stop, t, u, arg.prec);
+
+    _arb_vec_clear(t, 2 * arg.pow);
+    _arb_vec_clear(u, 2 * arg.pow);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* the blocks of a level are independent and can be split over threads */
+static void
+_arb_poly_interpolate_fast_level(arb_ptr pb, arb_srcptr pa, long pow,
+    long num, arb_ptr t, arb_ptr u, long prec)
+{
+    long i, num_threads;
+    pthread_t * threads;
+    interpolate_fast_arg_t * args;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    if (num_threads <= 1 ||
+        (double) num * pow * prec < ARB_POLY_TREE_THREAD_CUTOFF)
+    {
+        _arb_poly_interpolate_fast_blocks(pb, pa, pow, 0, num, t, u, prec);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(interpolate_fast_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].pb = pb;
+        args[i].pa = pa;
+        args[i].pow = pow;
+        args[i].start = (num * i) / num_threads;
+        args[i].stop = (num * (i + 1)) / num_threads;
+        args[i].prec = prec;
+        pthread_create(&threads[i], NULL,
+            _arb_poly_interpolate_fast_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 _arb_poly_interpolate_fast_precomp(arb_ptr poly,
     arb_srcptr ys, arb_ptr * tree, arb_srcptr weights,
     long len, long prec)
 {
     arb_ptr t, u, pa, pb;
-    long i, pow, left;
+    long i, pow, left, num;
 
     if (len == 0)
         return;
@@ -77,20 +169,13 @@ _arb_poly_interpolate_fast_precomp(arb_ptr poly,
     for (i = 0; i < FLINT_CLOG2(len); i++)
     {
         pow = (1L << i);
-        pa = tree[i];
-        pb = poly;
-        left = len;
+        num = len / (2 * pow);
+        left = len - num * 2 * pow;
 
-        while (left >= 2 * pow)
-        {
-            _arb_poly_mul(t, pa, pow + 1, pb + pow, pow, prec);
-            _arb_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, prec);
-            _arb_vec_add(pb, t, u, 2 * pow, prec);
+        _arb_poly_interpolate_fast_level(poly, tree[i], pow, num, t, u, prec);
 
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-        }
+        pa = tree[i] + num * (2 * pow + 2);
+        pb = poly + num * 2 * pow;
 
         if (left > pow)
         {
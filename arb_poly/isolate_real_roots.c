@@ -0,0 +1,407 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+/* The root box has a width of the form 2^e (2^ODD_BITS + 1), so that the
+   subdivision points are never simple dyadic numbers (such as integers)
+   at which the sign of the polynomial cannot be determined. With
+   ODD_BITS < MAG_BITS, the balls for subintervals are exact. */
+#define ODD_BITS 20
+
+typedef struct
+{
+    arb_srcptr poly;
+    long len;
+    arf_struct lower;
+    arf_struct width;
+    long maxdepth;
+    long prec;
+    arb_ptr roots;
+    int * flags;
+    long length;
+    long alloc;
+}
+isolate_ctx_struct;
+
+typedef isolate_ctx_struct isolate_ctx_t[1];
+
+/* 0 means that it *could* be zero; otherwise +/- 1 */
+static __inline__ int
+_arb_sign(const arb_t t)
+{
+    if (arb_is_positive(t))
+        return 1;
+    else if (arb_is_negative(t))
+        return -1;
+    else
+        return 0;
+}
+
+/* Upper bound for the number of sign variations in the sequence of
+   coefficients, allowing either sign for coefficients that contain zero
+   (exact zeros are skipped). Returns -1 if the first or last entry is
+   not known to be nonzero. */
+static long
+_arb_vec_sign_variations_bound(arb_srcptr vec, long len)
+{
+    long i, pos, neg, t;
+
+    if (!_arb_vec_is_finite(vec, len) ||
+        !arb_is_nonzero(vec) || !arb_is_nonzero(vec + len - 1))
+        return -1;
+
+    /* maximum number of variations so far, ending with a positive
+       resp. negative sign (-1 if impossible) */
+    pos = arb_is_positive(vec) ? 0 : -1;
+    neg = arb_is_negative(vec) ? 0 : -1;
+
+    for (i = 1; i < len; i++)
+    {
+        if (arb_is_zero(vec + i))
+            continue;
+
+        t = pos;
+
+        if (!arb_is_negative(vec + i))
+            pos = FLINT_MAX(pos, (neg >= 0) ? neg + 1 : -1);
+        else
+            pos = -1;
+
+        if (!arb_is_positive(vec + i))
+            neg = FLINT_MAX(neg, (t >= 0) ? t + 1 : -1);
+        else
+            neg = -1;
+    }
+
+    return FLINT_MAX(pos, neg);
+}
+
+static void
+_arb_set_interval_exact(arb_t x, const arf_t a, const arf_t b)
+{
+    arf_t t;
+    arf_init(t);
+
+    arf_add(arb_midref(x), a, b, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(arb_midref(x), arb_midref(x), -1);
+    arf_sub(t, b, a, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(t, t, -1);
+    arf_get_mag(arb_radref(x), t);
+
+    arf_clear(t);
+}
+
+static void
+add_root(isolate_ctx_t ctx, const arb_t x, int flag)
+{
+    if (ctx->length >= ctx->alloc)
+    {
+        long new_alloc;
+        new_alloc = (ctx->alloc == 0) ? 1 : 2 * ctx->alloc;
+        ctx->roots = flint_realloc(ctx->roots, sizeof(arb_struct) * new_alloc);
+        ctx->flags = flint_realloc(ctx->flags, sizeof(int) * new_alloc);
+        ctx->alloc = new_alloc;
+    }
+
+    arb_init(ctx->roots + ctx->length);
+    arb_set(ctx->roots + ctx->length, x);
+    ctx->flags[ctx->length] = flag;
+    ctx->length++;
+}
+
+/* Given [a, b] containing a single root of poly, with the polynomial
+   having sign asign to the left of the root, computes an enclosure
+   of the root to about prec bits by bisection followed by Newton
+   iteration once the interval is small enough for Newton's method
+   to converge. */
+static void
+refine_root(arb_t r, arb_srcptr poly, long len,
+    const arf_t a0, const arf_t b0, int asign, long prec)
+{
+    arf_t a, b, m, C;
+    arb_t x, y, t;
+    long iter, padding;
+    int msign, done;
+
+    arf_init(a);
+    arf_init(b);
+    arf_init(m);
+    arf_init(C);
+    arb_init(x);
+    arb_init(y);
+    arb_init(t);
+
+    arf_set(a, a0);
+    arf_set(b, b0);
+    done = 0;
+
+    for (iter = 0; iter < prec && !done; iter++)
+    {
+        _arb_set_interval_exact(x, a, b);
+
+        _arb_poly_newton_convergence_factor(C, poly, len, x, prec);
+
+        if (arf_is_finite(C))
+        {
+            padding = 5 + FLINT_MAX(arf_abs_bound_lt_2exp_si(C), 0);
+
+            if (_arb_poly_newton_step(y, poly, len, x, x, C, prec) &&
+                arb_rel_accuracy_bits(y) > 2 * padding + 2)
+            {
+                _arb_poly_newton_refine_root(r, poly, len, y, x, C, 0, prec);
+                done = 1;
+                break;
+            }
+        }
+
+        arf_add(m, a, b, ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_mul_2exp_si(m, m, -1);
+        arb_set_arf(t, m);
+        _arb_poly_evaluate(y, poly, len, t, prec);
+        msign = _arb_sign(y);
+
+        if (msign == 0)
+            break;
+
+        if (msign == asign)
+            arf_swap(a, m);
+        else
+            arf_swap(b, m);
+    }
+
+    if (!done)
+        _arb_set_interval_exact(r, a, b);
+
+    arf_clear(a);
+    arf_clear(b);
+    arf_clear(m);
+    arf_clear(C);
+    arb_clear(x);
+    arb_clear(y);
+    arb_clear(t);
+}
+
+/* The polynomial q (of length ctx->len) is a positive multiple of
+   p(lower + width (c + x) / 2^depth), so that the roots of q on (0, 1)
+   correspond to the roots of p on the subinterval I. */
+static void
+isolate_recursive(isolate_ctx_t ctx, arb_srcptr q,
+    const fmpz_t c, long depth)
+{
+    long i, n, v, prec;
+    arb_ptr t;
+    arb_t one, x;
+    arf_t a, b;
+    fmpz_t c2;
+    int asign;
+
+    n = ctx->len;
+    prec = ctx->prec;
+
+    arb_init(one);
+    arb_one(one);
+
+    /* Descartes' rule of signs for (x+1)^(n-1) q(1/(x+1)) */
+    t = _arb_vec_init(n);
+    _arb_poly_reverse(t, q, n, n);
+    _arb_poly_taylor_shift(t, one, n, prec);
+    v = _arb_vec_sign_variations_bound(t, n);
+    asign = _arb_sign(t + n - 1);
+
+    if (v != 0 && (v == 1 || depth >= ctx->maxdepth))
+    {
+        arf_init(a);
+        arf_init(b);
+        arb_init(x);
+
+        arf_mul_fmpz(a, &ctx->width, c, ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_mul_2exp_si(a, a, -depth);
+        arf_add(a, a, &ctx->lower, ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_mul_2exp_si(b, &ctx->width, -depth);
+        arf_add(b, b, a, ARF_PREC_EXACT, ARF_RND_DOWN);
+
+        if (v == 1)
+            refine_root(x, ctx->poly, ctx->len, a, b, asign, prec);
+        else
+            _arb_set_interval_exact(x, a, b);
+
+        add_root(ctx, x, v == 1);
+
+        arf_clear(a);
+        arf_clear(b);
+        arb_clear(x);
+    }
+    else if (v != 0)
+    {
+        /* left half: 2^(n-1) q(x/2); right half: the same, shifted by 1 */
+        for (i = 0; i < n; i++)
+            arb_mul_2exp_si(t + i, q + i, n - 1 - i);
+
+        fmpz_init(c2);
+        fmpz_mul_2exp(c2, c, 1);
+        isolate_recursive(ctx, t, c2, depth + 1);
+
+        _arb_poly_taylor_shift(t, one, n, prec);
+        fmpz_add_ui(c2, c2, 1);
+        isolate_recursive(ctx, t, c2, depth + 1);
+        fmpz_clear(c2);
+    }
+
+    _arb_vec_clear(t, n);
+    arb_clear(one);
+}
+
+long
+_arb_poly_isolate_real_roots(arb_ptr * roots, int ** flags,
+    arb_srcptr poly, long len, long maxdepth, long prec)
+{
+    isolate_ctx_t ctx;
+    arb_ptr q;
+    arb_t t, w;
+    mag_t lead, u;
+    arf_t r;
+    fmpz_t c;
+    long i, e, k, n;
+
+    ctx->poly = poly;
+    ctx->len = len;
+    ctx->maxdepth = maxdepth;
+    ctx->prec = prec;
+    ctx->roots = NULL;
+    ctx->flags = NULL;
+    ctx->length = 0;
+    ctx->alloc = 0;
+
+    if (len <= 1)
+    {
+        if (len == 0 || !arb_is_nonzero(poly))
+        {
+            arb_init(t);
+            arb_zero_pm_inf(t);
+            add_root(ctx, t, 0);
+            arb_clear(t);
+        }
+
+        *roots = ctx->roots;
+        *flags = ctx->flags;
+        return ctx->length;
+    }
+
+    if (!_arb_vec_is_finite(poly, len) || !arb_is_nonzero(poly + len - 1))
+    {
+        arb_init(t);
+        arb_zero_pm_inf(t);
+        add_root(ctx, t, 0);
+        arb_clear(t);
+
+        *roots = ctx->roots;
+        *flags = ctx->flags;
+        return ctx->length;
+    }
+
+    n = len - 1;
+
+    mag_init(lead);
+    mag_init(u);
+    arf_init(r);
+
+    /* Fujiwara's bound: all roots satisfy |z| < 2 max |a_i / a_n|^(1/(n-i)) */
+    arb_get_mag_lower(lead, poly + n);
+    e = 0;
+    for (i = 0; i < n; i++)
+    {
+        if (arb_is_zero(poly + i))
+            continue;
+
+        arb_get_mag(u, poly + i);
+        mag_div(u, u, lead);
+        arf_set_mag(r, u);
+        k = arf_abs_bound_lt_2exp_si(r);
+
+        if (k >= 0)
+            k = (k + (n - i) - 1) / (n - i);
+        else
+            k = -((-k) / (n - i));
+
+        e = FLINT_MAX(e, k + 1);
+    }
+
+    /* box [-2^e, -2^e + 2^(e+1-ODD_BITS) (2^ODD_BITS + 1)] */
+    arf_init(&ctx->lower);
+    arf_init(&ctx->width);
+    arf_set_si_2exp_si(&ctx->lower, -1, e);
+    arf_set_ui_2exp_si(&ctx->width, (1UL << ODD_BITS) + 1, e + 1 - ODD_BITS);
+
+    /* q(x) = p(lower + width x) */
+    q = _arb_vec_init(len);
+    arb_init(t);
+    arb_init(w);
+
+    _arb_vec_set(q, poly, len);
+    arb_set_arf(t, &ctx->lower);
+    _arb_poly_taylor_shift(q, t, len, prec);
+
+    arb_set_arf(w, &ctx->width);
+    arb_set(t, w);
+    for (i = 1; i < len; i++)
+    {
+        arb_mul(q + i, q + i, t, prec);
+        if (i + 1 < len)
+            arb_mul(t, t, w, prec);
+    }
+
+    fmpz_init(c);
+    isolate_recursive(ctx, q, c, 0);
+    fmpz_clear(c);
+
+    _arb_vec_clear(q, len);
+    arb_clear(t);
+    arb_clear(w);
+    arf_clear(&ctx->lower);
+    arf_clear(&ctx->width);
+    mag_clear(lead);
+    mag_clear(u);
+    arf_clear(r);
+
+    if (ctx->length != 0)
+    {
+        ctx->roots = flint_realloc(ctx->roots, ctx->length * sizeof(arb_struct));
+        ctx->flags = flint_realloc(ctx->flags, ctx->length * sizeof(int));
+    }
+
+    *roots = ctx->roots;
+    *flags = ctx->flags;
+
+    return ctx->length;
+}
+
+long
+arb_poly_isolate_real_roots(arb_ptr * roots, int ** flags,
+    const arb_poly_t poly, long maxdepth, long prec)
+{
+    return _arb_poly_isolate_real_roots(roots, flags,
+        poly->coeffs, poly->length, maxdepth, prec);
+}
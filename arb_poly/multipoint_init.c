@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+void
+arb_poly_multipoint_init(arb_poly_multipoint_t M,
+    arb_srcptr xs, long n, long prec)
+{
+    M->len = n;
+    M->prec = prec;
+    M->tree = _arb_poly_tree_alloc(n);
+    M->tree_inv = _arb_poly_tree_inv_alloc(n);
+    M->weights = _arb_vec_init(n);
+
+    _arb_poly_tree_build(M->tree, xs, n, prec);
+    _arb_poly_tree_inv_build(M->tree_inv, M->tree, n, prec);
+    _arb_poly_interpolation_weights(M->weights, M->tree, n, prec);
+}
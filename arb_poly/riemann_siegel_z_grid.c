@@ -0,0 +1,458 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include <math.h>
+#include "arb_poly.h"
+#include "acb_poly/powsum_impl.h"
+
+/* grid heights beyond which the Dirichlet polynomial of length
+   ~ max |t| / pi is not tabulated */
+#define Z_GRID_SIEVE_MAX 100000
+
+/* Sets z to sum_{k=1}^n k^(-(s+y)) as a power series in y, where
+   powers holds k^(-s) for the odd primes k <= n and logs holds log(k)
+   for all odd k <= n (if len != 1). The entries of powers for odd
+   composite k <= n / 3 are overwritten. This is the sieving scheme of
+   _acb_poly_powsum_one_series_sieved, except that no powers of primes
+   are computed here. */
+static void
+powsum_sieved_from_primes(acb_ptr z, acb_ptr powers, arb_srcptr logs,
+    const long * divisors, const acb_t pow2, const arb_t log2,
+    long n, long len, long prec)
+{
+    long i, k, power_of_two, horner_point;
+    acb_ptr t, u, x, tmp;
+    acb_t v;
+
+    t = _acb_vec_init(len);
+    u = _acb_vec_init(len);
+    x = _acb_vec_init(len);
+    tmp = _acb_vec_init(len);
+    acb_init(v);
+
+    power_of_two = 1;
+    while (power_of_two * 2 <= n)
+        power_of_two *= 2;
+    horner_point = n / power_of_two;
+
+    _acb_vec_zero(z, len);
+
+    /* x = 2^(-(s+y)) */
+    acb_set(x, pow2);
+    for (i = 1; i < len; i++)
+    {
+        acb_mul_arb(x + i, x + i - 1, log2, prec);
+        acb_div_si(x + i, x + i, -i, prec);
+    }
+
+    for (k = 1; k <= n; k += 2)
+    {
+        if (k == 1)
+            acb_one(t);
+        else if (DIVISOR(k) == 0)
+            acb_set(t, POWER(k));
+        else
+        {
+            acb_mul(t, POWER(DIVISOR(k)), POWER(k / DIVISOR(k)), prec);
+            if (k * 3 <= n)
+                acb_set(POWER(k), t);
+        }
+
+        _acb_poly_powsum_add_term(u, t, LOG(k), v, len, prec);
+
+        while (k == horner_point && power_of_two != 1)
+        {
+            _acb_poly_powsum_horner_step(z, u, x, t, tmp, len, prec);
+
+            power_of_two /= 2;
+            horner_point = n / power_of_two;
+            horner_point -= (horner_point % 2 == 0);
+        }
+    }
+
+    _acb_poly_powsum_horner_step(z, u, x, t, tmp, len, prec);
+
+    _acb_vec_clear(t, len);
+    _acb_vec_clear(u, len);
+    _acb_vec_clear(x, len);
+    _acb_vec_clear(tmp, len);
+    acb_clear(v);
+}
+
+/* sets t to k^(-1/2 - i t0) and r to k^(-i delta), given log(k) */
+static void
+prime_power_and_rotation(acb_t t, acb_t r, ulong k, const arb_t logk,
+    const arb_t t0, const arb_t delta, arb_t w, long prec)
+{
+    arb_mul(w, logk, t0, prec);
+    arb_neg(w, w);
+    arb_sin_cos(acb_imagref(t), acb_realref(t), w, prec);
+    arb_rsqrt_ui(w, k, prec);
+    acb_mul_arb(t, t, w, prec);
+
+    arb_mul(w, logk, delta, prec);
+    arb_neg(w, w);
+    arb_sin_cos(acb_imagref(r), acb_realref(r), w, prec);
+}
+
+static void
+_arb_poly_riemann_siegel_z_grid_sieved(arb_ptr res, const arb_t t0,
+    const arb_t delta, long num, long len, long n, long wp, long prec)
+{
+    long * divisors;
+    long i, j, k;
+    acb_ptr powers, rotations, z, zr, sx;
+    arb_ptr logs, th, c, s, q;
+    acb_t a, pow2, rot2;
+    arb_t t, w, log2, logk;
+    ulong kprev;
+
+    arb_init(t);
+    arb_init(w);
+    arb_init(log2);
+    arb_init(logk);
+    acb_init(a);
+    acb_init(pow2);
+    acb_init(rot2);
+
+    divisors = flint_calloc(n / 2 + 1, sizeof(long));
+    powers = _acb_vec_init(n / 2 + 1);
+    rotations = _acb_vec_init(n / 2 + 1);
+    logs = _arb_vec_init(n / 2 + 1);
+
+    _acb_poly_powsum_sieve(divisors, n);
+
+    /* logarithms of all odd k (of the odd primes only if len == 1),
+       the initial powers k^(-s_0) and the rotations k^(-i delta) */
+    kprev = 0;
+    for (k = 3; k <= n; k += 2)
+    {
+        if (DIVISOR(k) == 0)
+        {
+            arb_log_ui_from_prev(logk, k, logk, kprev, wp);
+            kprev = k;
+            arb_set(LOG(k), logk);
+            prime_power_and_rotation(POWER(k), rotations + (k - 1) / 2,
+                k, logk, t0, delta, w, wp);
+        }
+        else if (len != 1)
+        {
+            arb_add(LOG(k), LOG(DIVISOR(k)), LOG(k / DIVISOR(k)), wp);
+        }
+    }
+
+    arb_const_log2(log2, wp);
+    prime_power_and_rotation(pow2, rot2, 2, log2, t0, delta, w, wp);
+
+    z = _acb_vec_init(len);
+    zr = _acb_vec_init(len);
+    sx = _acb_vec_init(2);
+    th = _arb_vec_init(len);
+    c = _arb_vec_init(len);
+    s = _arb_vec_init(len);
+    q = _arb_vec_init(len);
+
+    acb_set_ui(a, n + 1);
+
+    for (j = 0; j < num; j++)
+    {
+        /* t = t_j */
+        arb_mul_ui(t, delta, j, wp);
+        arb_add(t, t, t0, wp);
+
+        /* sum_{k=1}^n k^(-(s_j + y)), then substitute y = i x */
+        powsum_sieved_from_primes(z, powers, logs, divisors, pow2, log2,
+            n, len, wp);
+
+        for (i = 1; i < len; i++)
+        {
+            if (i % 4 == 1)
+                acb_mul_onei(z + i, z + i);
+            else if (i % 4 == 2)
+                acb_neg(z + i, z + i);
+            else if (i % 4 == 3)
+            {
+                acb_mul_onei(z + i, z + i);
+                acb_neg(z + i, z + i);
+            }
+        }
+
+        /* add zeta(s_j + i x, n + 1) */
+        arb_one(acb_realref(sx));
+        arb_mul_2exp_si(acb_realref(sx), acb_realref(sx), -1);
+        arb_set(acb_imagref(sx), t);
+        if (len > 1)
+            acb_onei(sx + 1);
+        _acb_poly_zeta_series(zr, sx, FLINT_MIN(len, 2), a, 0, len, wp);
+        _acb_vec_add(z, z, zr, len, wp);
+
+        /* Z = Re(exp(i theta) zeta) */
+        arb_set(th, t);
+        if (len > 1)
+            arb_one(th + 1);
+        _arb_poly_riemann_siegel_theta_series(q, th, FLINT_MIN(len, 2), len, wp);
+        _arb_poly_sin_cos_series(s, c, q, len, len, wp);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_set(th + i, acb_realref(z + i));
+            arb_set(q + i, acb_imagref(z + i));
+        }
+
+        _arb_poly_mullow(res + j * len, c, len, th, len, len, wp);
+        _arb_poly_mullow(th, s, len, q, len, len, wp);
+        _arb_vec_sub(res + j * len, res + j * len, th, len, prec);
+
+        /* advance the prime powers to t_{j+1} */
+        if (j < num - 1)
+        {
+            for (k = 3; k <= n; k += 2)
+                if (DIVISOR(k) == 0)
+                    acb_mul(POWER(k), POWER(k), rotations + (k - 1) / 2, wp);
+
+            acb_mul(pow2, pow2, rot2, wp);
+        }
+    }
+
+    flint_free(divisors);
+    _acb_vec_clear(powers, n / 2 + 1);
+    _acb_vec_clear(rotations, n / 2 + 1);
+    _arb_vec_clear(logs, n / 2 + 1);
+    _acb_vec_clear(z, len);
+    _acb_vec_clear(zr, len);
+    _acb_vec_clear(sx, 2);
+    _arb_vec_clear(th, len);
+    _arb_vec_clear(c, len);
+    _arb_vec_clear(s, len);
+    _arb_vec_clear(q, len);
+
+    arb_clear(t);
+    arb_clear(w);
+    arb_clear(log2);
+    arb_clear(logk);
+    acb_clear(a);
+    acb_clear(pow2);
+    acb_clear(rot2);
+}
+
+/* Z(t_j) for len == 1 using the Riemann-Siegel formula with K correction
+   terms, given t_j >= 200 for all j; the powers n^(-1/2-i t_j) in the
+   main sum are shared between the grid points like the prime powers
+   above, but all n <= sqrt(max t_j / (2 pi)) are rotated since the
+   length of the main sum varies with t_j */
+static void
+_arb_poly_riemann_siegel_z_grid_rs(arb_ptr res, const arb_t t0,
+    const arb_t delta, long num, long K, long nmax, long wp, long prec)
+{
+    acb_ptr powers, rotations;
+    acb_t S;
+    arb_t t, w, logn, theta, c, s, R;
+    long j, n, N;
+
+    powers = _acb_vec_init(nmax);
+    rotations = _acb_vec_init(nmax);
+    acb_init(S);
+    arb_init(t);
+    arb_init(w);
+    arb_init(logn);
+    arb_init(theta);
+    arb_init(c);
+    arb_init(s);
+    arb_init(R);
+
+    /* n^(-1/2 - i t0) and n^(-i delta) */
+    for (n = 1; n <= nmax; n++)
+    {
+        if (n == 1)
+        {
+            acb_one(powers);
+            acb_one(rotations);
+            continue;
+        }
+
+        arb_log_ui_from_prev(logn, n, logn, n - 1, wp);
+        prime_power_and_rotation(powers + n - 1, rotations + n - 1,
+            n, logn, t0, delta, w, wp);
+    }
+
+    for (j = 0; j < num; j++)
+    {
+        arb_mul_ui(t, delta, j, wp);
+        arb_add(t, t, t0, wp);
+
+        if (_acb_zeta_rs_correction(R, &N, t, K, wp) && N <= nmax)
+        {
+            /* Z = 2 Re(exp(i theta) sum_{n=1}^N n^(-1/2-it)) + R */
+            acb_zero(S);
+            for (n = 0; n < N; n++)
+                acb_add(S, S, powers + n, wp);
+
+            _arb_poly_riemann_siegel_theta_series(theta, t, 1, 1, wp);
+            arb_sin_cos(s, c, theta, wp);
+            arb_mul(w, c, acb_realref(S), wp);
+            arb_submul(w, s, acb_imagref(S), wp);
+            arb_mul_2exp_si(w, w, 1);
+            arb_add(res + j, w, R, prec);
+        }
+        else
+        {
+            _arb_poly_riemann_siegel_z_series(res + j, t, 1, 1, prec);
+        }
+
+        if (j < num - 1)
+            for (n = 1; n < nmax; n++)
+                acb_mul(powers + n, powers + n, rotations + n, wp);
+    }
+
+    _acb_vec_clear(powers, nmax);
+    _acb_vec_clear(rotations, nmax);
+    acb_clear(S);
+    arb_clear(t);
+    arb_clear(w);
+    arb_clear(logn);
+    arb_clear(theta);
+    arb_clear(c);
+    arb_clear(s);
+    arb_clear(R);
+}
+
+/* smallest number of Riemann-Siegel correction terms that suffices at
+   both ends of the grid (and therefore in between), or -1 */
+static long
+_arb_poly_riemann_siegel_z_grid_rs_k(const arb_t t0, const arb_t t1,
+    long prec)
+{
+    acb_t s;
+    long K0, K1;
+
+    acb_init(s);
+    arb_one(acb_realref(s));
+    arb_mul_2exp_si(acb_realref(s), acb_realref(s), -1);
+    arb_set(acb_imagref(s), t0);
+    K0 = acb_zeta_rs_choose_k(s, prec);
+    arb_set(acb_imagref(s), t1);
+    K1 = acb_zeta_rs_choose_k(s, prec);
+    acb_clear(s);
+
+    if (K0 < 0 || K1 < 0)
+        return -1;
+
+    return FLINT_MAX(K0, K1);
+}
+
+void
+_arb_poly_riemann_siegel_z_grid(arb_ptr res, const arb_t t0,
+    const arb_t delta, long num, long len, long prec)
+{
+    long j, n, K, wp;
+    arb_t t, u0, e;
+    arf_t u, v;
+    double d;
+
+    if (num <= 0 || len <= 0)
+        return;
+
+    /* the updates k^(-s_j) = k^(-s_{j-1}) k^(-i delta) add up errors
+       linearly in the number of grid points */
+    wp = prec + FLINT_BIT_COUNT(num) + 2 * FLINT_BIT_COUNT(len) + 10;
+
+    arb_init(t);
+    arb_init(u0);
+    arb_init(e);
+    arf_init(u);
+    arf_init(v);
+
+    arb_mul_ui(t, delta, num - 1, wp);
+    arb_add(t, t, t0, wp);
+    arb_get_abs_ubound_arf(u, t, 30);
+    arb_get_abs_ubound_arf(v, t0, 30);
+    arf_max(u, u, v);
+    d = arf_get_d(u, ARF_RND_UP);
+
+    /* the phases t log(k) must be accurate to wp bits */
+    if (arf_is_finite(u) && arf_cmpabs_2exp_si(u, 0) > 0)
+        wp += 2 * arf_abs_bound_lt_2exp_si(u);
+
+    K = -1;
+    if (len == 1 && num > 1 && arb_is_finite(delta))
+        K = _arb_poly_riemann_siegel_z_grid_rs_k(t0, t, prec);
+
+    /* the grid must not cross zero; Z is even, so a grid of negative
+       heights is reflected to positive heights */
+    if (K >= 0 && !((arb_is_positive(t0) && arb_is_positive(t)) ||
+                    (arb_is_negative(t0) && arb_is_negative(t))))
+        K = -1;
+
+    if (K >= 0)
+    {
+        /* O(sqrt(t)) terms per point */
+        n = sqrt(d / 6.283185307179586) + 2;
+
+        if (arb_is_positive(t0))
+        {
+            arb_set(u0, t0);
+            arb_set(e, delta);
+        }
+        else
+        {
+            arb_neg(u0, t0);
+            arb_neg(e, delta);
+        }
+
+        _arb_poly_riemann_siegel_z_grid_rs(res, u0, e, num, K, n, wp, prec);
+    }
+    else if (num > 1 && arb_is_finite(t0) && arb_is_finite(delta)
+        && d / 3.14159265358979323846 >= 10
+        && d / 3.14159265358979323846 < Z_GRID_SIEVE_MAX)
+    {
+        /* n ~ max |t_j| / pi, so that the remaining Hurwitz zeta function
+           zeta(s, n + 1) is evaluated with |Im(s)| ~ pi a */
+        n = (long) (d / 3.14159265358979323846) + 1;
+        _arb_poly_riemann_siegel_z_grid_sieved(res, t0, delta,
+            num, len, n, wp, prec);
+    }
+    else
+    {
+        arb_ptr h = _arb_vec_init(2);
+        arb_one(h + 1);
+
+        for (j = 0; j < num; j++)
+        {
+            arb_mul_ui(h, delta, j, wp);
+            arb_add(h, h, t0, wp);
+            _arb_poly_riemann_siegel_z_series(res + j * len, h,
+                FLINT_MIN(len, 2), len, prec);
+        }
+
+        _arb_vec_clear(h, 2);
+    }
+
+    arb_clear(t);
+    arb_clear(u0);
+    arb_clear(e);
+    arf_clear(u);
+    arf_clear(v);
+}
@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+void
+_arb_poly_taylor_shift_convolution(arb_ptr p, const arb_t c, long len, long prec)
+{
+    arb_ptr t, u;
+    long i;
+
+    if (arb_is_zero(c) || len <= 1)
+        return;
+
+    t = _arb_vec_init(len);
+    u = _arb_vec_init(len);
+
+    /* p(x+c) = B(rev(rev(B^{-1}(p)) * e^{cx})) where B is the Borel transform */
+    _arb_poly_inv_borel_transform(p, p, len, prec);
+    _arb_poly_reverse(p, p, len, len);
+
+    arb_one(u);
+    for (i = 1; i < len; i++)
+    {
+        arb_mul(u + i, u + i - 1, c, prec);
+        arb_div_ui(u + i, u + i, i, prec);
+    }
+
+    _arb_poly_mullow(t, p, len, u, len, len, prec);
+
+    _arb_poly_reverse(p, t, len, len);
+    _arb_poly_borel_transform(p, p, len, prec);
+
+    _arb_vec_clear(t, len);
+    _arb_vec_clear(u, len);
+}
+
+void
+arb_poly_taylor_shift_convolution(arb_poly_t g, const arb_poly_t f,
+    const arb_t c, long prec)
+{
+    if (f != g)
+        arb_poly_set(g, f);
+
+    _arb_poly_taylor_shift_convolution(g->coeffs, c, g->length, prec);
+}
@@ -0,0 +1,163 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("isolate_real_roots....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500; iter++)
+    {
+        long i, j, n, num, found, prec, maxdepth;
+        fmpq_poly_t F, G;
+        fmpq * r;
+        arb_poly_t f;
+        arb_ptr roots;
+        int * flags;
+
+        n = n_randint(state, 10);
+        prec = 100 + n_randint(state, 200);
+        maxdepth = 100;
+
+        fmpq_poly_init(F);
+        fmpq_poly_init(G);
+        arb_poly_init(f);
+        r = _fmpq_vec_init(n);
+
+        /* random distinct rational roots, times x^2 + 1 */
+        fmpq_poly_set_coeff_ui(F, 0, 1);
+        fmpq_poly_set_coeff_ui(F, 2, 1);
+
+        for (i = 0; i < n; i++)
+        {
+            do
+            {
+                fmpq_randtest(r + i, state, 1 + n_randint(state, 6));
+                for (j = 0; j < i; j++)
+                    if (fmpq_equal(r + i, r + j))
+                        break;
+            } while (j < i);
+
+            /* G = r - x */
+            fmpq_poly_zero(G);
+            fmpq_poly_set_coeff_si(G, 1, -1);
+            fmpq_poly_set_coeff_fmpq(G, 0, r + i);
+            fmpq_poly_mul(F, F, G);
+        }
+
+        arb_poly_set_fmpq_poly(f, F, prec);
+
+        num = arb_poly_isolate_real_roots(&roots, &flags, f, maxdepth, prec);
+
+        /* all roots must be accounted for */
+        for (i = 0; i < n; i++)
+        {
+            found = 0;
+            for (j = 0; j < num; j++)
+                found += arb_contains_fmpq(roots + j, r + i);
+
+            if (found == 0)
+            {
+                printf("FAIL: missing root\n\n");
+                printf("F = "); fmpq_poly_print(F); printf("\n\n");
+                printf("r = "); fmpq_print(r + i); printf("\n\n");
+                abort();
+            }
+        }
+
+        /* isolated roots must contain exactly one root, and with
+           this much precision, everything should be isolated */
+        found = 0;
+        for (j = 0; j < num; j++)
+        {
+            long count = 0;
+
+            for (i = 0; i < n; i++)
+                count += arb_contains_fmpq(roots + j, r + i);
+
+            if (flags[j] == 1)
+            {
+                found++;
+
+                if (count != 1)
+                {
+                    printf("FAIL: bad isolated root\n\n");
+                    printf("F = "); fmpq_poly_print(F); printf("\n\n");
+                    printf("root = "); arb_printd(roots + j, 15); printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        if (found != n)
+        {
+            printf("FAIL: roots not isolated (%ld of %ld)\n\n", found, n);
+            printf("F = "); fmpq_poly_print(F); printf("\n\n");
+            for (j = 0; j < num; j++)
+            {
+                arb_printd(roots + j, 15);
+                printf("   %d\n", flags[j]);
+            }
+            abort();
+        }
+
+        /* the output is sorted */
+        for (j = 0; j + 1 < num; j++)
+        {
+            arb_t t;
+            arb_init(t);
+            arb_sub(t, roots + j + 1, roots + j, prec);
+
+            if (arb_is_negative(t))
+            {
+                printf("FAIL: output not sorted\n\n");
+                printf("F = "); fmpq_poly_print(F); printf("\n\n");
+                abort();
+            }
+
+            arb_clear(t);
+        }
+
+        _arb_vec_clear(roots, num);
+        flint_free(flags);
+
+        fmpq_poly_clear(F);
+        fmpq_poly_clear(G);
+        arb_poly_clear(f);
+        _fmpq_vec_clear(r, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+
+#include "arb_poly.h"
+
+/* with exact grid points, a grid value should be about as accurate as
+   the value computed pointwise, unless it is close to zero (where the
+   absolute errors of the two algorithms may differ) */
+static int
+accuracy_ok(const arb_t res, const arb_t z, long prec)
+{
+    if (arf_cmpabs_2exp_si(arb_midref(z), -4) < 0)
+        return 1;
+
+    return arb_rel_accuracy_bits(res) >=
+        FLINT_MIN(arb_rel_accuracy_bits(z), prec) - 10;
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("riemann_siegel_z_grid....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300; iter++)
+    {
+        arb_t t0, delta;
+        arb_ptr res, h, z;
+        long i, j, num, len, prec;
+
+        num = 1 + n_randint(state, 20);
+        len = 1 + n_randint(state, 3);
+        prec = 2 + n_randint(state, 150);
+
+        arb_init(t0);
+        arb_init(delta);
+        res = _arb_vec_init(num * len);
+        h = _arb_vec_init(2);
+        z = _arb_vec_init(len);
+
+        arb_set_ui(t0, n_randint(state, 3000));
+        arb_set_ui(delta, 1 + n_randint(state, 1000));
+        if (n_randint(state, 2))
+            arb_div_ui(delta, delta, 1 + n_randint(state, 1000), prec);
+        else
+            arb_mul_2exp_si(delta, delta, -(long) n_randint(state, 10));
+        if (n_randint(state, 2))
+            arb_neg(t0, t0);
+
+        _arb_poly_riemann_siegel_z_grid(res, t0, delta, num, len, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            arb_mul_ui(h, delta, j, prec + 20);
+            arb_add(h, h, t0, prec + 20);
+            arb_one(h + 1);
+            _arb_poly_riemann_siegel_z_series(z, h, FLINT_MIN(len, 2), len, prec);
+
+            for (i = 0; i < len; i++)
+            {
+                if (!arb_overlaps(z + i, res + j * len + i))
+                {
+                    printf("FAIL: overlap\n\n");
+                    printf("num = %ld, len = %ld, prec = %ld, j = %ld, i = %ld\n\n",
+                        num, len, prec, j, i);
+                    printf("t0 = "); arb_printd(t0, 15); printf("\n\n");
+                    printf("delta = "); arb_printd(delta, 15); printf("\n\n");
+                    printf("z = "); arb_printd(z + i, 15); printf("\n\n");
+                    printf("res = "); arb_printd(res + j * len + i, 15); printf("\n\n");
+                    abort();
+                }
+
+                if (arb_is_exact(delta) &&
+                    !accuracy_ok(res + j * len + i, z + i, prec))
+                {
+                    printf("FAIL: accuracy\n\n");
+                    printf("num = %ld, len = %ld, prec = %ld, j = %ld, i = %ld\n\n",
+                        num, len, prec, j, i);
+                    printf("t0 = "); arb_printd(t0, 15); printf("\n\n");
+                    printf("delta = "); arb_printd(delta, 15); printf("\n\n");
+                    printf("z = "); arb_printd(z + i, 15); printf("\n\n");
+                    printf("res = "); arb_printd(res + j * len + i, 15); printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        arb_clear(t0);
+        arb_clear(delta);
+        _arb_vec_clear(res, num * len);
+        _arb_vec_clear(h, 2);
+        _arb_vec_clear(z, len);
+    }
+
+    /* heights where the Riemann-Siegel formula is used */
+    for (iter = 0; iter < 100; iter++)
+    {
+        arb_t t0, delta, h, z;
+        arb_ptr res;
+        long j, num, prec;
+
+        num = 2 + n_randint(state, 10);
+        prec = 2 + n_randint(state, 30);
+
+        arb_init(t0);
+        arb_init(delta);
+        arb_init(h);
+        arb_init(z);
+        res = _arb_vec_init(num);
+
+        arb_set_ui(t0, 200 + n_randint(state, 20000));
+        arb_set_ui(delta, 1 + n_randint(state, 1000));
+        if (n_randint(state, 2))
+            arb_div_ui(delta, delta, 1 + n_randint(state, 100), prec);
+        else
+            arb_mul_2exp_si(delta, delta, -(long) n_randint(state, 7));
+        if (n_randint(state, 2))
+        {
+            arb_neg(t0, t0);
+            arb_neg(delta, delta);
+        }
+
+        _arb_poly_riemann_siegel_z_grid(res, t0, delta, num, 1, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            arb_mul_ui(h, delta, j, prec + 20);
+            arb_add(h, h, t0, prec + 20);
+            _arb_poly_riemann_siegel_z_series(z, h, 1, 1, prec);
+
+            if (!arb_overlaps(z, res + j))
+            {
+                printf("FAIL: overlap (Riemann-Siegel)\n\n");
+                printf("num = %ld, prec = %ld, j = %ld\n\n", num, prec, j);
+                printf("t0 = "); arb_printd(t0, 15); printf("\n\n");
+                printf("delta = "); arb_printd(delta, 15); printf("\n\n");
+                printf("z = "); arb_printd(z, 15); printf("\n\n");
+                printf("res = "); arb_printd(res + j, 15); printf("\n\n");
+                abort();
+            }
+
+            if (arb_is_exact(delta) && !accuracy_ok(res + j, z, prec))
+            {
+                printf("FAIL: accuracy (Riemann-Siegel)\n\n");
+                printf("num = %ld, prec = %ld, j = %ld\n\n", num, prec, j);
+                printf("t0 = "); arb_printd(t0, 15); printf("\n\n");
+                printf("delta = "); arb_printd(delta, 15); printf("\n\n");
+                printf("z = "); arb_printd(z, 15); printf("\n\n");
+                printf("res = "); arb_printd(res + j, 15); printf("\n\n");
+                abort();
+            }
+        }
+
+        arb_clear(t0);
+        arb_clear(delta);
+        arb_clear(h);
+        arb_clear(z);
+        _arb_vec_clear(res, num);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("taylor_shift....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        long prec1, prec2;
+        arb_poly_t f, g, h1, h2;
+        fmpq_poly_t F, G;
+        fmpq_t c;
+        arb_t d;
+
+        prec1 = 2 + n_randint(state, 200);
+        prec2 = 2 + n_randint(state, 200);
+
+        arb_poly_init(f);
+        arb_poly_init(g);
+        arb_poly_init(h1);
+        arb_poly_init(h2);
+        fmpq_poly_init(F);
+        fmpq_poly_init(G);
+        fmpq_init(c);
+        arb_init(d);
+
+        fmpq_poly_randtest(F, state, 1 + n_randint(state, 60), 1 + n_randint(state, 100));
+        fmpq_randtest(c, state, 1 + n_randint(state, 10));
+
+        /* G = F(x + c) */
+        fmpq_poly_zero(G);
+        fmpq_poly_set_coeff_fmpq(G, 0, c);
+        fmpq_poly_set_coeff_ui(G, 1, 1);
+        fmpq_poly_compose(G, F, G);
+
+        arb_poly_set_fmpq_poly(f, F, prec1);
+        arb_set_fmpq(d, c, prec1);
+
+        arb_poly_taylor_shift(g, f, d, prec2);
+
+        if (!arb_poly_contains_fmpq_poly(g, G))
+        {
+            printf("FAIL (containment)\n\n");
+            printf("F = "); fmpq_poly_print(F); printf("\n\n");
+            printf("c = "); fmpq_print(c); printf("\n\n");
+            printf("g = "); arb_poly_printd(g, 15); printf("\n\n");
+            abort();
+        }
+
+        arb_poly_taylor_shift_horner(h1, f, d, prec2);
+        arb_poly_taylor_shift_convolution(h2, f, d, prec2);
+
+        if (!arb_poly_overlaps(h1, h2) || !arb_poly_overlaps(g, h1))
+        {
+            printf("FAIL (horner/convolution)\n\n");
+            printf("F = "); fmpq_poly_print(F); printf("\n\n");
+            printf("c = "); fmpq_print(c); printf("\n\n");
+            printf("h1 = "); arb_poly_printd(h1, 15); printf("\n\n");
+            printf("h2 = "); arb_poly_printd(h2, 15); printf("\n\n");
+            abort();
+        }
+
+        arb_poly_taylor_shift(f, f, d, prec2);
+
+        if (!arb_poly_equal(f, g))
+        {
+            printf("FAIL (aliasing)\n\n");
+            abort();
+        }
+
+        arb_poly_clear(f);
+        arb_poly_clear(g);
+        arb_poly_clear(h1);
+        arb_poly_clear(h2);
+        fmpq_poly_clear(F);
+        fmpq_poly_clear(G);
+        fmpq_clear(c);
+        arb_clear(d);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("tree_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* the threaded code must give exactly the same results */
+    for (iter = 0; iter < 20; iter++)
+    {
+        long i, n, plen, prec;
+        arb_ptr x, y1, y2, p1, p2, f;
+
+        n = 100 + n_randint(state, 400);
+        plen = 1 + n_randint(state, 2 * n);
+        prec = 400 + n_randint(state, 800);
+
+        x = _arb_vec_init(n);
+        y1 = _arb_vec_init(n);
+        y2 = _arb_vec_init(n);
+        p1 = _arb_vec_init(n);
+        p2 = _arb_vec_init(n);
+        f = _arb_vec_init(plen);
+
+        for (i = 0; i < n; i++)
+        {
+            arb_randtest(x + i, state, prec, 0);
+            arb_add_si(x + i, x + i, 4 * i - 2 * n, prec);
+        }
+        for (i = 0; i < plen; i++)
+            arb_randtest(f + i, state, prec, 4);
+
+        flint_set_num_threads(1);
+        _arb_poly_evaluate_vec_fast(y1, f, plen, x, n, prec);
+        _arb_poly_interpolate_fast(p1, x, y1, n, prec);
+
+        flint_set_num_threads(2 + n_randint(state, 6));
+        _arb_poly_evaluate_vec_fast(y2, f, plen, x, n, prec);
+        _arb_poly_interpolate_fast(p2, x, y1, n, prec);
+
+        for (i = 0; i < n; i++)
+        {
+            if (!arb_equal(y1 + i, y2 + i) || !arb_equal(p1 + i, p2 + i))
+            {
+                printf("FAIL (n = %ld, plen = %ld, prec = %ld, i = %ld)\n\n",
+                    n, plen, prec, i);
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, n);
+        _arb_vec_clear(y1, n);
+        _arb_vec_clear(y2, n);
+        _arb_vec_clear(p1, n);
+        _arb_vec_clear(p2, n);
+        _arb_vec_clear(f, plen);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+/*
+Level i of the inverse tree corresponds to level i of the product tree,
+for i = 0, ..., height - 1 (the top level is never used as a modulus).
+Entry k of level i, stored at offset k 2^i, is the inverse of the
+reversal of polynomial k of the product tree level, to length 2^i.
+*/
+
+arb_ptr * _arb_poly_tree_inv_alloc(long len)
+{
+    arb_ptr * tree_inv = NULL;
+
+    if (len > 1)
+    {
+        long i, pow, height = FLINT_CLOG2(len);
+
+        tree_inv = flint_malloc(sizeof(arb_ptr) * height);
+        for (i = 0; i < height; i++)
+        {
+            pow = 1L << i;
+            tree_inv[i] = _arb_vec_init(((len + pow - 1) / pow) * pow);
+        }
+    }
+
+    return tree_inv;
+}
+
+void _arb_poly_tree_inv_free(arb_ptr * tree_inv, long len)
+{
+    if (len > 1)
+    {
+        long i, pow, height = FLINT_CLOG2(len);
+
+        for (i = 0; i < height; i++)
+        {
+            pow = 1L << i;
+            _arb_vec_clear(tree_inv[i], ((len + pow - 1) / pow) * pow);
+        }
+
+        flint_free(tree_inv);
+    }
+}
+
+void _arb_poly_tree_inv_build(arb_ptr * tree_inv, arb_ptr * tree,
+    long len, long prec)
+{
+    long i, k, m, num, pow, height;
+    arb_ptr rev;
+
+    if (len < 2)
+        return;
+
+    height = FLINT_CLOG2(len);
+    rev = _arb_vec_init((1L << (height - 1)) + 1);
+
+    for (i = 0; i < height; i++)
+    {
+        pow = 1L << i;
+        num = (len + pow - 1) / pow;
+
+        for (k = 0; k < num; k++)
+        {
+            m = FLINT_MIN(pow, len - k * pow);
+            _arb_poly_reverse(rev, tree[i] + k * (pow + 1), m + 1, m + 1);
+            _arb_poly_inv_series(tree_inv[i] + k * pow, rev, m + 1, pow, prec);
+        }
+    }
+
+    _arb_vec_clear(rev, (1L << (height - 1)) + 1);
+}
@@ -39,12 +39,34 @@ void partitions_rademacher_bound(arf_t b, const fmpz_t n, ulong N);
 
 void partitions_hrr_sum_arb(arb_t x, const fmpz_t n, long N0, long N, int use_doubles);
 
+void partitions_hrr_sum_arb_vec(arb_ptr x, const fmpz * n, long len,
+    long N0, long N, int use_doubles);
+
 void partitions_fmpz_fmpz(fmpz_t p, const fmpz_t n, int use_doubles);
 
 void partitions_fmpz_ui(fmpz_t p, ulong n);
 
 void partitions_fmpz_ui_using_doubles(fmpz_t p, ulong n);
 
+void partitions_fmpz_fmpz_vec(fmpz * res, const fmpz_t n, ulong d, long len,
+    int use_doubles);
+
+#define PARTITIONS_SMALL_CUTOFF_DEFAULT 2000
+
+extern TLS_PREFIX long partitions_cache_num;
+
+extern TLS_PREFIX fmpz * partitions_cache;
+
+extern TLS_PREFIX ulong partitions_small_cutoff;
+
+void partitions_cache_compute(long n);
+
+void partitions_cleanup(void);
+
+void partitions_set_small_cutoff(ulong n);
+
+ulong partitions_get_small_cutoff(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2014 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+
+TLS_PREFIX long partitions_cache_num = 0;
+
+TLS_PREFIX fmpz * partitions_cache = NULL;
+
+TLS_PREFIX ulong partitions_small_cutoff = PARTITIONS_SMALL_CUTOFF_DEFAULT;
+
+void
+partitions_set_small_cutoff(ulong n)
+{
+    partitions_small_cutoff = n;
+}
+
+ulong
+partitions_get_small_cutoff(void)
+{
+    return partitions_small_cutoff;
+}
+
+void
+partitions_cleanup(void)
+{
+    _fmpz_vec_clear(partitions_cache, partitions_cache_num);
+    partitions_cache = NULL;
+    partitions_cache_num = 0;
+}
+
+/* Extends the table using Euler's pentagonal number theorem,
+   p(m) = sum_{j >= 1} (-1)^(j+1) (p(m - j(3j-1)/2) + p(m - j(3j+1)/2)). */
+void
+partitions_cache_compute(long n)
+{
+    if (partitions_cache_num < n)
+    {
+        long i, j, m, new_num;
+        fmpz_t s;
+
+        if (partitions_cache_num == 0)
+        {
+            flint_register_cleanup_function(partitions_cleanup);
+        }
+
+        new_num = FLINT_MAX(partitions_cache_num + 128, n);
+
+        partitions_cache = flint_realloc(partitions_cache,
+            new_num * sizeof(fmpz));
+        for (i = partitions_cache_num; i < new_num; i++)
+            fmpz_init(partitions_cache + i);
+
+        fmpz_init(s);
+
+        for (m = partitions_cache_num; m < new_num; m++)
+        {
+            if (m == 0)
+            {
+                fmpz_one(partitions_cache);
+                continue;
+            }
+
+            fmpz_zero(s);
+
+            for (j = 1; j * (3 * j - 1) / 2 <= m; j++)
+            {
+                i = m - j * (3 * j - 1) / 2;
+
+                if (j % 2)
+                    fmpz_add(s, s, partitions_cache + i);
+                else
+                    fmpz_sub(s, s, partitions_cache + i);
+
+                i -= j;
+
+                if (i >= 0)
+                {
+                    if (j % 2)
+                        fmpz_add(s, s, partitions_cache + i);
+                    else
+                        fmpz_sub(s, s, partitions_cache + i);
+                }
+            }
+
+            fmpz_swap(partitions_cache + m, s);
+        }
+
+        fmpz_clear(s);
+
+        partitions_cache_num = new_num;
+    }
+}
+
@@ -36,6 +36,7 @@ typedef struct
 {
     arb_ptr x;
     fmpz * n;
+    long len;
     ulong N0;
     ulong N;
     int use_doubles;
@@ -46,43 +47,170 @@ static void *
 worker(void * arg_ptr)
 {
     worker_arg_t arg = *((worker_arg_t *) arg_ptr);
-    partitions_hrr_sum_arb(arg.x, arg.n, arg.N0, arg.N, arg.use_doubles);
+    partitions_hrr_sum_arb_vec(arg.x, arg.n, arg.len,
+        arg.N0, arg.N, arg.use_doubles);
     flint_cleanup();
     return NULL;
 }
 
+#define HRR_PI 3.141592653589793238462643
+#define HRR_INV_LOG2 1.44269504088896340735992468
+
+/* Estimated cost, in bit operations per term, of the per-term work
+   (factoring k, the exponential sum, bookkeeping) which does not
+   depend on the precision. */
+#define HRR_TERM_OVERHEAD 64.0
+
+/*
+Estimated total cost of the terms 1 <= k <= K. Term k is computed
+to roughly B/k bits, where B is the size of the first term; ignoring
+logarithmic factors, the cost is therefore B H_K + c K.
+*/
+static double
+hrr_cost(double B, double K)
+{
+    double H;
+
+    if (K < 1)
+        return 0.0;
+
+    H = log(K) + 0.5772156649015329 + 0.5 / K;
+    return B * H + HRR_TERM_OVERHEAD * K;
+}
+
+/* Splits [1, N] into contiguous ranges of roughly equal estimated cost;
+   returns the number of nonempty ranges. */
+static long
+hrr_split(long * ends, const fmpz_t n, long N, long num_threads)
+{
+    double B, total, target;
+    long i, lo, hi, mid, prev, num;
+
+    B = HRR_PI * sqrt(24 * fmpz_get_d(n) - 1) / 6.0 * HRR_INV_LOG2;
+    total = hrr_cost(B, N);
+
+    prev = 0;
+    num = 0;
+
+    for (i = 1; i < num_threads && prev < N; i++)
+    {
+        target = (total * i) / num_threads;
+
+        /* smallest k with cost(k) >= target */
+        lo = prev + 1;
+        hi = N;
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+            if (hrr_cost(B, mid) >= target)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+
+        if (lo < N)
+        {
+            ends[num++] = lo;
+            prev = lo;
+        }
+    }
+
+    ends[num++] = N;
+    return num;
+}
+
 /* TODO: set number of threads in child threads, for future
    multithreaded evaluation of single terms */
 static void
-hrr_sum_threaded(arb_t x, const fmpz_t n, long N, int use_doubles)
+hrr_sum_threaded(arb_ptr x, const fmpz * n, long len, const fmpz_t nmax,
+    long N, int use_doubles)
 {
-    arb_t y;
-    pthread_t threads[2];
-    worker_arg_t args[2];
+    long i, j, num_threads, * ends;
+    pthread_t * threads;
+    worker_arg_t * args;
+    arb_ptr y;
 
-    arb_init(y);
+    num_threads = flint_get_num_threads();
+    ends = flint_malloc(sizeof(long) * num_threads);
+    num_threads = hrr_split(ends, nmax, N, num_threads);
 
-    args[0].x = x;
-    args[0].n = (fmpz *) n;
-    args[0].N0 = 1;
-    args[0].N = 16;
-    args[0].use_doubles = use_doubles;
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(worker_arg_t) * num_threads);
+    y = _arb_vec_init(num_threads * len);
 
-    args[1].x = y;
-    args[1].n = (fmpz *) n;
-    args[1].N0 = 17;
-    args[1].N = N;
-    args[1].use_doubles = use_doubles;
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].x = y + i * len;
+        args[i].n = (fmpz *) n;
+        args[i].len = len;
+        args[i].N0 = (i == 0) ? 1 : ends[i - 1] + 1;
+        args[i].N = ends[i];
+        args[i].use_doubles = use_doubles;
 
-    pthread_create(&threads[0], NULL, worker, &args[0]);
-    pthread_create(&threads[1], NULL, worker, &args[1]);
+        pthread_create(&threads[i], NULL, worker, &args[i]);
+    }
 
-    pthread_join(threads[0], NULL);
-    pthread_join(threads[1], NULL);
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
 
-    arb_add(x, x, y, ARF_PREC_EXACT);
+    /* add in a fixed order, independent of scheduling */
+    for (j = 0; j < len; j++)
+    {
+        arb_zero(x + j);
+        for (i = 0; i < num_threads; i++)
+            arb_add(x + j, x + j, y + i * len + j, ARF_PREC_EXACT);
+    }
 
-    arb_clear(y);
+    _arb_vec_clear(y, num_threads * len);
+    flint_free(threads);
+    flint_free(args);
+    flint_free(ends);
+}
+
+/* Sets p[i] = p(n[i]) for len values n[i] > 2 which are close enough
+   for the terms of the HRR series to be evaluated together. */
+static void
+hrr_eval(fmpz * p, const fmpz * n, long len, int use_doubles)
+{
+    arb_ptr x;
+    arf_t bound;
+    long i, j, N;
+
+    x = _arb_vec_init(len);
+    arf_init(bound);
+
+    j = 0;
+    for (i = 1; i < len; i++)
+        if (fmpz_cmp(n + i, n + j) > 0)
+            j = i;
+
+    N = partitions_hrr_needed_terms(fmpz_get_d(n + j));
+
+    if (fmpz_cmp_ui(n + j, 4e8) >= 0 && flint_get_num_threads() > 1)
+    {
+        hrr_sum_threaded(x, n, len, n + j, N, use_doubles);
+    }
+    else
+    {
+        partitions_hrr_sum_arb_vec(x, n, len, 1, N, use_doubles);
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        partitions_rademacher_bound(bound, n + i, N);
+        arb_add_error_arf(x + i, bound);
+
+        if (!arb_get_unique_fmpz(p + i, x + i))
+        {
+            printf("not unique!\n");
+            arb_printd(x + i, 50);
+            printf("\n");
+            abort();
+        }
+    }
+
+    _arb_vec_clear(x, len);
+    arf_clear(bound);
 }
 
 void
@@ -97,38 +225,75 @@ partitions_fmpz_fmpz(fmpz_t p, const fmpz_t n, int use_doubles)
     }
     else
     {
-        arb_t x;
-        arf_t bound;
-        long N;
+        hrr_eval(p, n, 1, use_doubles);
+    }
+}
 
-        arb_init(x);
-        arf_init(bound);
+/* Maximum number of values evaluated together, and maximum relative
+   spread of a block; beyond this, the shared precision is wasteful. */
+#define HRR_VEC_BLOCK 256
+#define HRR_VEC_SPREAD 16
 
-        N = partitions_hrr_needed_terms(fmpz_get_d(n));
+void
+partitions_fmpz_fmpz_vec(fmpz * res, const fmpz_t n, ulong d, long len,
+    int use_doubles)
+{
+    fmpz * v;
+    fmpz_t t;
+    long i, j, start, num;
 
-        if (fmpz_cmp_ui(n, 4e8) >= 0 && flint_get_num_threads() > 1)
-        {
-            hrr_sum_threaded(x, n, N, use_doubles);
-        }
-        else
+    if (len < 1)
+        return;
+
+    v = _fmpz_vec_init(len);
+    fmpz_init(t);
+
+    fmpz_set(v, n);
+    for (i = 1; i < len; i++)
+        fmpz_add_ui(v + i, v + i - 1, d);
+
+    /* small n: table lookup or the memoised pentagonal recurrence */
+    num = 0;
+    for (i = 0; i < len; i++)
+        if (fmpz_cmp_ui(v + i, partitions_small_cutoff) < 0
+            && fmpz_cmp_ui(v + i, NUMBER_OF_SMALL_PARTITIONS) >= 0)
+            num = FLINT_MAX(num, fmpz_get_ui(v + i) + 1);
+
+    partitions_cache_compute(num);
+
+    for (i = 0; i < len; i++)
+    {
+        if (fmpz_sgn(v + i) < 0)
+            fmpz_zero(res + i);
+        else if (fmpz_cmp_ui(v + i, NUMBER_OF_SMALL_PARTITIONS) < 0)
+            fmpz_set_ui(res + i, partitions_lookup[fmpz_get_ui(v + i)]);
+        else if (fmpz_cmp_ui(v + i, partitions_small_cutoff) < 0)
+            fmpz_set(res + i, partitions_cache + fmpz_get_ui(v + i));
+    }
+
+    /* large n: blocks of nearby values share the HRR evaluation */
+    for (start = 0; start < len; start = j)
+    {
+        if (fmpz_cmp_ui(v + start, NUMBER_OF_SMALL_PARTITIONS) < 0 ||
+            fmpz_cmp_ui(v + start, partitions_small_cutoff) < 0)
         {
-            partitions_hrr_sum_arb(x, n, 1, N, use_doubles);
+            j = start + 1;
+            continue;
         }
 
-        partitions_rademacher_bound(bound, n, N);
-        arb_add_error_arf(x, bound);
-
-        if (!arb_get_unique_fmpz(p, x))
+        for (j = start + 1; j < len && j - start < HRR_VEC_BLOCK; j++)
         {
-            printf("not unique!\n");
-            arb_printd(x, 50);
-            printf("\n");
-            abort();
+            fmpz_sub(t, v + j, v + start);
+            fmpz_mul_ui(t, t, HRR_VEC_SPREAD);
+            if (fmpz_cmp(t, v + start) > 0)
+                break;
         }
 
-        arb_clear(x);
-        arf_clear(bound);
+        hrr_eval(res + start, v + start, j - start, use_doubles);
     }
+
+    _fmpz_vec_clear(v, len);
+    fmpz_clear(t);
 }
 
 void
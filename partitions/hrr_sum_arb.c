@@ -170,8 +170,112 @@ eval_trig_prod_d(trig_prod_t prod)
     return s;
 }
 
+/*
+Cache of cos(pi p / q) for small q. The same denominators occur in the
+factored exponential sums of many different k, and since the working
+precision decreases with k, a stored value can usually be rounded instead
+of being recomputed. Only values of moderate precision are kept, so that
+the memory usage stays bounded.
+*/
+#define COS_CACHE_MAX_Q 256
+#define COS_CACHE_MAX_PREC 4096
+
+typedef struct
+{
+    arb_ptr vals[COS_CACHE_MAX_Q + 1];
+    long * precs[COS_CACHE_MAX_Q + 1];
+}
+cos_cache_struct;
+
+typedef cos_cache_struct cos_cache_t[1];
+
+static void
+cos_cache_init(cos_cache_t cache)
+{
+    long q;
+
+    for (q = 0; q <= COS_CACHE_MAX_Q; q++)
+    {
+        cache->vals[q] = NULL;
+        cache->precs[q] = NULL;
+    }
+}
+
+static void
+cos_cache_clear(cos_cache_t cache)
+{
+    long q;
+
+    for (q = 0; q <= COS_CACHE_MAX_Q; q++)
+    {
+        if (cache->vals[q] != NULL)
+        {
+            _arb_vec_clear(cache->vals[q], q / 2 + 1);
+            flint_free(cache->precs[q]);
+        }
+    }
+}
+
+static void
+cos_pi_pq_cached(arb_t res, cos_cache_t cache,
+    mp_limb_signed_t p, mp_limb_signed_t q, long prec)
+{
+    mp_limb_signed_t g;
+    int negate;
+
+    /* reduce to 0 <= p <= q/2, using cos(pi - x) = -cos(x) */
+    p = FLINT_ABS(p);
+    p %= (2 * q);
+    if (p > q)
+        p = 2 * q - p;
+
+    negate = (2 * p > q);
+    if (negate)
+        p = q - p;
+
+    if (p == 0)
+    {
+        arb_set_si(res, negate ? -1 : 1);
+        return;
+    }
+
+    g = n_gcd(q, p);
+    p /= g;
+    q /= g;
+
+    if (q > COS_CACHE_MAX_Q || prec > COS_CACHE_MAX_PREC)
+    {
+        fmpq_t pq;
+        *fmpq_numref(pq) = p;
+        *fmpq_denref(pq) = q;
+        arb_cos_pi_fmpq(res, pq, prec);
+    }
+    else
+    {
+        if (cache->vals[q] == NULL)
+        {
+            cache->vals[q] = _arb_vec_init(q / 2 + 1);
+            cache->precs[q] = flint_calloc(q / 2 + 1, sizeof(long));
+        }
+
+        if (cache->precs[q][p] < prec)
+        {
+            fmpq_t pq;
+            *fmpq_numref(pq) = p;
+            *fmpq_denref(pq) = q;
+            arb_cos_pi_fmpq(cache->vals[q] + p, pq, prec);
+            cache->precs[q][p] = prec;
+        }
+
+        arb_set_round(res, cache->vals[q] + p, prec);
+    }
+
+    if (negate)
+        arb_neg(res, res);
+}
+
 static void
-eval_trig_prod(arb_t sum, trig_prod_t prod, long prec)
+eval_trig_prod(arb_t sum, trig_prod_t prod, cos_cache_t cache, long prec)
 {
     int i;
     mp_limb_t v;
@@ -205,10 +309,7 @@ eval_trig_prod(arb_t sum, trig_prod_t prod, long prec)
 
     for (i = 0; i < prod->n; i++)
     {
-        fmpq_t pq;
-        *fmpq_numref(pq) = prod->cos_p[i];
-        *fmpq_denref(pq) = prod->cos_q[i];
-        arb_cos_pi_fmpq(t, pq, prec);
+        cos_pi_pq_cached(t, cache, prod->cos_p[i], prod->cos_q[i], prec);
         arb_mul(sum, sum, t, prec);
     }
 
@@ -234,20 +335,37 @@ sinh_cosh_divk_precomp(arb_t sh, arb_t ch, arb_t ex, long k, long prec)
 
 
 void
-partitions_hrr_sum_arb(arb_t x, const fmpz_t n, long N0, long N, int use_doubles)
+partitions_hrr_sum_arb_vec(arb_ptr x, const fmpz * n, long len,
+    long N0, long N, int use_doubles)
 {
     trig_prod_t prod;
-    arb_t acc, C, t1, t2, t3, t4, exp1;
-    fmpz_t n24;
-    long k, prec, res_prec, acc_prec, guard_bits;
-    double nd, Cd;
+    cos_cache_t cache;
+    arb_ptr acc, C, ex;
+    arb_t t1, t2, t3, t4;
+    fmpz * n24;
+    double * Cd;
+    long i, j, k, prec, res_prec, acc_prec, guard_bits;
+    int prec_done;
+    double nd;
+
+    if (len < 1)
+        return;
 
-    if (fmpz_cmp_ui(n, 2) <= 0)
+    /* the precision is chosen for the largest n, which is sufficient
+       for all entries */
+    j = 0;
+    for (i = 0; i < len; i++)
     {
-        abort();
+        if (fmpz_cmp_ui(n + i, 2) <= 0)
+        {
+            abort();
+        }
+
+        if (fmpz_cmp(n + i, n + j) > 0)
+            j = i;
     }
 
-    nd = fmpz_get_d(n);
+    nd = fmpz_get_d(n + j);
 
     /* compute initial precision */
     guard_bits = 2 * FLINT_BIT_COUNT(N) + 32;
@@ -255,43 +373,58 @@ partitions_hrr_sum_arb(arb_t x, const fmpz_t n, long N0, long N, int use_doubles
     prec = FLINT_MAX(prec, DOUBLE_PREC);
     res_prec = acc_prec = prec;
 
-    arb_init(acc);
-    arb_init(C);
+    acc = _arb_vec_init(len);
+    C = _arb_vec_init(len);
+    ex = _arb_vec_init(len);
+    n24 = _fmpz_vec_init(len);
+    Cd = flint_malloc(sizeof(double) * len);
+
     arb_init(t1);
     arb_init(t2);
     arb_init(t3);
     arb_init(t4);
-    arb_init(exp1);
-    fmpz_init(n24);
+    cos_cache_init(cache);
 
-    arb_zero(x);
+    arb_const_pi(t1, prec);
+    arb_div_ui(t1, t1, 6, prec);
 
-    /* n24 = 24n - 1 */
-    fmpz_set(n24, n);
-    fmpz_mul_ui(n24, n24, 24);
-    fmpz_sub_ui(n24, n24, 1);
+    for (i = 0; i < len; i++)
+    {
+        arb_zero(x + i);
 
-    /* C = (pi/6) sqrt(24n-1) */
-    arb_const_pi(t1, prec);
-    arb_sqrt_fmpz(t2, n24, prec);
-    arb_mul(t1, t1, t2, prec);
-    arb_div_ui(C, t1, 6, prec);
+        /* n24 = 24n - 1 */
+        fmpz_mul_ui(n24 + i, n + i, 24);
+        fmpz_sub_ui(n24 + i, n24 + i, 1);
 
-    /* exp1 = exp(C) */
-    arb_exp(exp1, C, prec);
+        /* C = (pi/6) sqrt(24n-1) */
+        arb_sqrt_fmpz(t2, n24 + i, prec);
+        arb_mul(C + i, t1, t2, prec);
 
-    Cd = PI * sqrt(24*nd-1) / 6;
+        /* exp(C), only needed for the precomputed roots below */
+        if (N0 < 35)
+            arb_exp(ex + i, C + i, prec);
+
+        Cd[i] = PI * sqrt(24 * fmpz_get_d(n + i) - 1) / 6;
+    }
 
     for (k = N0; k <= N; k++)
     {
-        trig_prod_init(prod);
-        arith_hrr_expsum_factored(prod, k, fmpz_fdiv_ui(n, k));
+        prec_done = 0;
 
-        if (prod->prefactor != 0)
+        for (i = 0; i < len; i++)
         {
+            trig_prod_init(prod);
+            arith_hrr_expsum_factored(prod, k, fmpz_fdiv_ui(n + i, k));
 
-            if (prec > MIN_PREC)
-                prec = partitions_prec_bound(nd, k, N);
+            if (prod->prefactor == 0)
+                continue;
+
+            if (!prec_done)
+            {
+                if (prec > MIN_PREC)
+                    prec = partitions_prec_bound(nd, k, N);
+                prec_done = 1;
+            }
 
             prod->prefactor *= 4;
             prod->sqrt_p *= 3;
@@ -300,15 +433,15 @@ partitions_hrr_sum_arb(arb_t x, const fmpz_t n, long N0, long N, int use_doubles
             if (prec > DOUBLE_CUTOFF || !use_doubles)
             {
                 /* Compute A_k(n) * sqrt(3/k) * 4 / (24*n-1) */
-                eval_trig_prod(t1, prod, prec);
-                arb_div_fmpz(t1, t1, n24, prec);
+                eval_trig_prod(t1, prod, cache, prec);
+                arb_div_fmpz(t1, t1, n24 + i, prec);
 
                 /* Multiply by (cosh(z) - sinh(z)/z) where z = C / k */
-                arb_set_round(t2, C, prec);
+                arb_set_round(t2, C + i, prec);
                 arb_div_ui(t2, t2, k, prec);
 
                 if (k < 35 && prec > 1000)
-                    sinh_cosh_divk_precomp(t3, t4, exp1, k, prec);
+                    sinh_cosh_divk_precomp(t3, t4, ex + i, k, prec);
                 else
                     arb_sinh_cosh(t3, t4, t2, prec);
 
@@ -320,8 +453,8 @@ partitions_hrr_sum_arb(arb_t x, const fmpz_t n, long N0, long N, int use_doubles
             {
                 double xx, zz, xxerr;
 
-                xx = eval_trig_prod_d(prod) / (24*nd - 1);
-                zz = Cd / k;
+                xx = eval_trig_prod_d(prod) / (24*fmpz_get_d(n + i) - 1);
+                zz = Cd[i] / k;
                 xx = xx * (cosh(zz) - sinh(zz) / zz);
 
                 xxerr = fabs(xx) * DOUBLE_ERR + DOUBLE_ERR;
@@ -330,27 +463,39 @@ partitions_hrr_sum_arb(arb_t x, const fmpz_t n, long N0, long N, int use_doubles
             }
 
             /* Add to accumulator */
-            arb_add(acc, acc, t1, acc_prec);
+            arb_add(acc + i, acc + i, t1, acc_prec);
+        }
 
-            if (acc_prec > 2 * prec + 32)
+        if (prec_done && acc_prec > 2 * prec + 32)
+        {
+            for (i = 0; i < len; i++)
             {
-                arb_add(x, x, acc, res_prec);
-                arb_zero(acc);
-                acc_prec = prec + 32;
+                arb_add(x + i, x + i, acc + i, res_prec);
+                arb_zero(acc + i);
             }
+
+            acc_prec = prec + 32;
         }
     }
 
-    arb_add(x, x, acc, res_prec);
+    for (i = 0; i < len; i++)
+        arb_add(x + i, x + i, acc + i, res_prec);
 
-    fmpz_clear(n24);
-    arb_clear(acc);
-    arb_clear(exp1);
-    arb_clear(C);
+    cos_cache_clear(cache);
+    _arb_vec_clear(acc, len);
+    _arb_vec_clear(C, len);
+    _arb_vec_clear(ex, len);
+    _fmpz_vec_clear(n24, len);
+    flint_free(Cd);
     arb_clear(t1);
     arb_clear(t2);
     arb_clear(t3);
     arb_clear(t4);
 }
 
+void
+partitions_hrr_sum_arb(arb_t x, const fmpz_t n, long N0, long N, int use_doubles)
+{
+    partitions_hrr_sum_arb_vec(x, n, 1, N0, N, use_doubles);
+}
 
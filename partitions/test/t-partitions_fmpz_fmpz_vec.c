@@ -0,0 +1,121 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+
+int main(void)
+{
+    flint_rand_t state;
+    long iter;
+
+    printf("partitions_fmpz_fmpz_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* check the pentagonal table against the power series */
+    {
+        fmpz * v;
+        long i, num = 3000;
+
+        v = _fmpz_vec_init(num);
+        arith_number_of_partitions_vec(v, num);
+        partitions_cache_compute(num);
+
+        for (i = 0; i < num; i++)
+        {
+            if (!fmpz_equal(partitions_cache + i, v + i))
+            {
+                printf("FAIL (pentagonal table):\n");
+                printf("n = %ld\n", i);
+                abort();
+            }
+        }
+
+        _fmpz_vec_clear(v, num);
+    }
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        fmpz * res;
+        fmpz_t n, m, p;
+        ulong d;
+        long i, len;
+
+        len = n_randint(state, 20);
+        res = _fmpz_vec_init(len);
+        fmpz_init(n);
+        fmpz_init(m);
+        fmpz_init(p);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                fmpz_set_si(n, n_randint(state, 200) - 100);
+                d = n_randint(state, 5);
+                break;
+            case 1:
+                fmpz_set_ui(n, n_randint(state, 5000));
+                d = n_randint(state, 100);
+                break;
+            default:
+                fmpz_set_ui(n, n_randint(state, 100000));
+                d = n_randint(state, 10000);
+        }
+
+        partitions_set_small_cutoff(n_randint(state, 4000));
+
+        partitions_fmpz_fmpz_vec(res, n, d, len, n_randint(state, 2));
+
+        for (i = 0; i < len; i++)
+        {
+            fmpz_set(m, n);
+            fmpz_add_ui(m, m, i * d);
+            partitions_fmpz_fmpz(p, m, 0);
+
+            if (!fmpz_equal(p, res + i))
+            {
+                printf("FAIL:\n");
+                printf("n = "); fmpz_print(m); printf("\n");
+                printf("Computed: "); fmpz_print(res + i); printf("\n");
+                printf("Expected: "); fmpz_print(p); printf("\n");
+                abort();
+            }
+        }
+
+        _fmpz_vec_clear(res, len);
+        fmpz_clear(n);
+        fmpz_clear(m);
+        fmpz_clear(p);
+    }
+
+    partitions_set_small_cutoff(PARTITIONS_SMALL_CUTOFF_DEFAULT);
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return 0;
+}
+
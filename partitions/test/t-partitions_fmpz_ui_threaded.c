@@ -140,6 +140,7 @@ int main(void)
 
         for (i = 0; testdata[i][0] != 0; i++)
         {
+            flint_set_num_threads(2 + n_randint(state, 7));
             partitions_fmpz_ui(p, testdata[i][0]);
 
             if (fmpz_fdiv_ui(p, 1000000000) != testdata[i][1])